@@ -11,6 +11,8 @@ GrafoWidget::GrafoWidget(QWidget *parent)
       , grafoNoDirigido(nullptr)
       , grafoDirigido(nullptr)
       , esDirigido(false)
+      , maximoCalorVertices(0)
+      , maximoCalorAristas(0)
       , arrastrando(false)
       , colorVertice(70, 130, 180)
       , colorVerticeSeleccionado(255, 69, 0)
@@ -75,7 +77,7 @@ void GrafoWidget::actualizarVisualizacion() {
 
     if (esDirigido && grafoDirigido) {
         // Actualizar vértices
-        auto listaVertices = grafoDirigido->getVertices();
+        auto listaVertices = grafoDirigido->getVerticesActivos();
         for (const auto &vertice: listaVertices) {
             if (!vertices.contains(vertice)) {
                 QPoint posicion = coordenadasCiudades.value(vertice, QPoint(0, 0));
@@ -87,7 +89,7 @@ void GrafoWidget::actualizarVisualizacion() {
         actualizarAristas();
     } else if (!esDirigido && grafoNoDirigido) {
         // Actualizar vértices
-        auto listaVertices = grafoNoDirigido->getVertices();
+        auto listaVertices = grafoNoDirigido->getVerticesActivos();
         for (const auto &vertice: listaVertices) {
             if (!vertices.contains(vertice)) {
                 QPoint posicion = coordenadasCiudades.value(vertice, QPoint(0, 0));
@@ -106,9 +108,70 @@ void GrafoWidget::actualizarVisualizacion() {
 void GrafoWidget::limpiar() {
     vertices.clear();
     aristas.clear();
+    comunidadVertices.clear();
+    limpiarMapaCalor();
+}
+
+void GrafoWidget::setMapaCalor(const QMap<QString, double> &valoresVertices,
+                               const QMap<QPair<QString, QString>, double> &valoresAristas) {
+    comunidadVertices.clear();
+    calorVertices = valoresVertices;
+    calorAristas = valoresAristas;
+    maximoCalorVertices = 0;
+    for (double valor: calorVertices)
+        maximoCalorVertices = std::max(maximoCalorVertices, valor);
+    maximoCalorAristas = 0;
+    for (double valor: calorAristas)
+        maximoCalorAristas = std::max(maximoCalorAristas, valor);
+    update();
+}
+
+void GrafoWidget::limpiarMapaCalor() {
+    calorVertices.clear();
+    calorAristas.clear();
+    maximoCalorVertices = 0;
+    maximoCalorAristas = 0;
     update();
 }
 
+void GrafoWidget::setComunidades(const QMap<QString, int> &comunidades) {
+    calorVertices.clear();
+    calorAristas.clear();
+    maximoCalorVertices = 0;
+    maximoCalorAristas = 0;
+    comunidadVertices = comunidades;
+    update();
+}
+
+void GrafoWidget::limpiarComunidades() {
+    comunidadVertices.clear();
+    update();
+}
+
+QColor GrafoWidget::colorComunidad(int comunidad) {
+    // Paso de tono por la razón áurea: comunidades consecutivas quedan bien separadas.
+    double tono = std::fmod(comunidad * 0.618033988749895, 1.0);
+    return QColor::fromHsvF(tono, 0.75, 0.9);
+}
+
+QColor GrafoWidget::colorCalor(double valor, double maximo) {
+    // Azul (frío) a rojo (caliente) recorriendo el tono.
+    double proporcion = maximo > 0 ? qBound(0.0, valor / maximo, 1.0) : 0;
+    return QColor::fromHsvF((1 - proporcion) * 240.0 / 360.0, 0.9, 0.95);
+}
+
+double GrafoWidget::calorDeArista(const AristaVisual &arista) const {
+    auto it = calorAristas.constFind(qMakePair(arista.origen, arista.destino));
+    if (it != calorAristas.constEnd())
+        return it.value();
+    if (!esDirigido) {
+        it = calorAristas.constFind(qMakePair(arista.destino, arista.origen));
+        if (it != calorAristas.constEnd())
+            return it.value();
+    }
+    return -1;
+}
+
 void GrafoWidget::seleccionarVertice(const QString &vertice) {
     limpiarSeleccion();
     if (vertices.contains(vertice)) {
@@ -241,6 +304,10 @@ void GrafoWidget::resizeEvent(QResizeEvent *event) {
 void GrafoWidget::dibujarVertice(QPainter &painter, const VerticeVisual &vertice) {
     // Configurar colores
     QColor colorRelleno = vertice.seleccionado ? colorVerticeSeleccionado : QColor(colorVertice);
+    if (!vertice.seleccionado && calorVertices.contains(vertice.etiqueta))
+        colorRelleno = colorCalor(calorVertices.value(vertice.etiqueta), maximoCalorVertices);
+    else if (!vertice.seleccionado && comunidadVertices.contains(vertice.etiqueta))
+        colorRelleno = colorComunidad(comunidadVertices.value(vertice.etiqueta));
     QColor colorBorde = colorRelleno.darker(150);
 
     painter.setPen(QPen(colorBorde, 3));
@@ -283,7 +350,19 @@ void GrafoWidget::dibujarArista(QPainter &painter, const AristaVisual &arista) {
 
     // Configurar estilo de la línea según selección
     QColor colorLinea = arista.seleccionada ? colorAristaSeleccionada : QColor(colorArista); // Azul para rutas
-    QPen penLinea(colorLinea, GROSOR_ARISTA + 1);
+    int grosor = GROSOR_ARISTA + 1;
+    double calor = calorDeArista(arista);
+    if (!arista.seleccionada && calor >= 0) {
+        colorLinea = colorCalor(calor, maximoCalorAristas);
+        grosor += maximoCalorAristas > 0 ? qRound(3 * calor / maximoCalorAristas) : 0;
+    } else if (!arista.seleccionada && comunidadVertices.contains(arista.origen) &&
+               comunidadVertices.contains(arista.destino)) {
+        int comunidad = comunidadVertices.value(arista.origen);
+        colorLinea = comunidad == comunidadVertices.value(arista.destino)
+                         ? colorComunidad(comunidad).darker(120)
+                         : QColor(180, 180, 180);
+    }
+    QPen penLinea(colorLinea, grosor);
 
     if (esDirigido) {
         // Verificar si existe la ruta inversa
@@ -429,7 +508,7 @@ void GrafoWidget::actualizarAristas() {
     aristas.clear();
 
     if (esDirigido && grafoDirigido) {
-        for (const auto &origen: grafoDirigido->getVertices()) {
+        for (const auto &origen: grafoDirigido->getVerticesActivos()) {
             auto adyacentes = grafoDirigido->getAdyacentesDelVerticeConPeso(origen);
             for (const auto &ady: adyacentes) {
                 QString destino = grafoDirigido->getVertice(ady.indiceVertice);
@@ -439,7 +518,7 @@ void GrafoWidget::actualizarAristas() {
     } else if (!esDirigido && grafoNoDirigido) {
         std::set<std::pair<QString, QString> > aristasYaAgregadas;
 
-        for (const auto &origen: grafoNoDirigido->getVertices()) {
+        for (const auto &origen: grafoNoDirigido->getVerticesActivos()) {
             auto adyacentes = grafoNoDirigido->getAdyacentesDelVerticeConPeso(origen);
             for (const auto &ady: adyacentes) {
                 QString destino = grafoNoDirigido->getVertice(ady.indiceVertice);
@@ -14,6 +14,7 @@
 #include <QBrush>
 #include <QColor>
 #include <QPolygon>
+#include <QPair>
 #include <cmath>
 
 #include "GrafosPesados/DiGrafoPesado.h"
@@ -80,6 +81,19 @@ public:
 
     void imprimirCoordenadasVertices() const;
 
+    // Colorea vértices y aristas (origen, destino) de frío a caliente según su valor,
+    // normalizado al máximo de cada mapa. Lo que no figura se dibuja normal.
+    void setMapaCalor(const QMap<QString, double> &valoresVertices,
+                      const QMap<QPair<QString, QString>, double> &valoresAristas);
+
+    void limpiarMapaCalor();
+
+    // Pinta cada vértice con el color de su comunidad. Las aristas internas toman ese
+    // color y las que unen comunidades distintas quedan grises. Reemplaza al mapa de calor.
+    void setComunidades(const QMap<QString, int> &comunidades);
+
+    void limpiarComunidades();
+
 signals:
     void verticeSeleccionado(const QString &vertice);
 
@@ -115,6 +129,13 @@ private:
 
     static QPoint calcularPuntoEnCirculo(const QPoint &centro, const QPoint &objetivo, int radio);
 
+    static QColor colorCalor(double valor, double maximo);
+
+    // Valor del mapa de calor para la arista; -1 si no tiene.
+    double calorDeArista(const AristaVisual &arista) const;
+
+    static QColor colorComunidad(int comunidad);
+
     // Nuevo método para inicializar coordenadas
     void inicializarCoordenadasCiudades();
 
@@ -143,6 +164,15 @@ private:
     QColor colorTexto;
     QColor colorFondo;
 
+    // Mapa de calor
+    QMap<QString, double> calorVertices;
+    QMap<QPair<QString, QString>, double> calorAristas;
+    double maximoCalorVertices;
+    double maximoCalorAristas;
+
+    // Comunidades
+    QMap<QString, int> comunidadVertices;
+
     // Interacción
     bool arrastrando;
     QString verticeArrastrado;
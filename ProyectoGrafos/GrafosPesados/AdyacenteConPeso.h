@@ -0,0 +1,37 @@
+#ifndef ADYACENTECONPESO_H
+#define ADYACENTECONPESO_H
+#include <cstdint>
+#include <limits>
+
+struct AdyacenteConPeso {
+    // Un arco sin capacidad declarada no limita el flujo.
+    static constexpr uint32_t SIN_CAPACIDAD = std::numeric_limits<uint32_t>::max();
+
+    int indiceVertice;
+    // Plazas de la ruta (p. ej. asientos); ocupa el relleno de alineación antes de los pesos.
+    uint32_t capacidad;
+    double distancia;
+    double tiempo;
+
+    explicit AdyacenteConPeso(int vertice) : indiceVertice(vertice), capacidad(SIN_CAPACIDAD), distancia(0),
+                                             tiempo(0) {
+    }
+
+    AdyacenteConPeso(int vertice, double distancia, double tiempo, uint32_t capacidad = SIN_CAPACIDAD)
+        : indiceVertice(vertice), capacidad(capacidad), distancia(distancia), tiempo(tiempo) {
+    }
+
+    bool operator<(const AdyacenteConPeso &otro) const {
+        return this->indiceVertice < otro.indiceVertice;
+    }
+
+    bool operator==(const AdyacenteConPeso &otro) const {
+        return this->indiceVertice == otro.indiceVertice;
+    }
+
+    bool operator!=(const AdyacenteConPeso &otro) const {
+        return !(*this == otro);
+    }
+};
+
+#endif //ADYACENTECONPESO_H
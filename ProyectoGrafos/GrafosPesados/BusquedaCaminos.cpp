@@ -0,0 +1,37 @@
+#include "BusquedaCaminos.h"
+
+TrazaDijkstra::TrazaDijkstra(std::ostream &salida, const EspacioConsulta &espacio, int cantidadVertices)
+    : salida(salida), espacio(espacio), cantidadVertices(cantidadVertices), iteracion(0) {
+}
+
+void TrazaDijkstra::imprimirCostos() const {
+    for (int i = 0; i < cantidadVertices; i++) {
+        double costo = espacio.getCosto(i);
+        if (costo >= EspacioConsulta::INFINITO) {
+            salida << "∞ ";
+        } else {
+            salida << costo << " ";
+        }
+    }
+    salida << std::endl;
+}
+
+void TrazaDijkstra::verticeCerrado(int vertice, double costo) {
+    salida << "Iteración " << ++iteracion << ":" << std::endl;
+    salida << "Vértice seleccionado: " << vertice << " (costo: " << costo << ")" << std::endl;
+}
+
+void TrazaDijkstra::verticeMejorado(int vertice, double costoAnterior, double costoNuevo, int predecesor) {
+    salida << "  Actualizando vértice " << vertice << ": " << costoAnterior << " -> " << costoNuevo << std::endl;
+}
+
+void TrazaDijkstra::adyacentesProcesados(int vertice) {
+    salida << "Costos actuales: ";
+    imprimirCostos();
+
+    salida << "Marcados: ";
+    for (int i = 0; i < cantidadVertices; i++) {
+        salida << (espacio.estaCerrado(i) ? "✓" : "✗") << " ";
+    }
+    salida << std::endl << std::endl;
+}
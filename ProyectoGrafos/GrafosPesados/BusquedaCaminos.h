@@ -0,0 +1,130 @@
+#ifndef BUSQUEDACAMINOS_H
+#define BUSQUEDACAMINOS_H
+#include <ostream>
+#include <span>
+#include <vector>
+
+#include "AdyacenteConPeso.h"
+#include "EspacioConsulta.h"
+#include "FiltroBusqueda.h"
+
+// Políticas de peso: qué costo aporta un arco a la búsqueda.
+struct PesoDistancia {
+    double operator()(const AdyacenteConPeso &arco) const {
+        return arco.distancia;
+    }
+};
+
+struct PesoTiempo {
+    double operator()(const AdyacenteConPeso &arco) const {
+        return arco.tiempo;
+    }
+};
+
+// Costo distancia + lambda * tiempo.
+struct PesoCombinado {
+    double lambda;
+
+    explicit PesoCombinado(double lambda) : lambda(lambda) {
+    }
+
+    double operator()(const AdyacenteConPeso &arco) const {
+        return arco.distancia + lambda * arco.tiempo;
+    }
+};
+
+// Condiciones de parada: se evalúan cuando un vértice queda cerrado (costo definitivo).
+struct SinParada {
+    bool operator()(int vertice, double costo) const {
+        return false;
+    }
+};
+
+// Además de detenerse, una parada puede definir podar(costo): las relajaciones que
+// superan el presupuesto no entran al montículo ni a la lista de tocados.
+struct ParadaPorPresupuesto {
+    double presupuesto;
+
+    explicit ParadaPorPresupuesto(double presupuesto) : presupuesto(presupuesto) {
+    }
+
+    bool operator()(int vertice, double costo) const {
+        return costo > presupuesto;
+    }
+
+    bool podar(double costo) const {
+        return costo > presupuesto;
+    }
+};
+
+struct ParadaEnDestino {
+    int destino;
+
+    explicit ParadaEnDestino(int destino) : destino(destino) {
+    }
+
+    bool operator()(int vertice, double costo) const {
+        return vertice == destino;
+    }
+};
+
+// Se detiene al cerrar todos los vértices marcados; 'restantes' es cuántos hay.
+struct ParadaEnDestinos {
+    const std::vector<char> *esDestino;
+    int restantes;
+
+    bool operator()(int vertice, double costo) {
+        return (*esDestino)[vertice] && --restantes == 0;
+    }
+};
+
+// Visitantes: reciben los eventos de la búsqueda. Los métodos vacíos se eliminan al compilar.
+struct VisitanteNulo {
+    void verticeCerrado(int vertice, double costo) {
+    }
+
+    void verticeMejorado(int vertice, double costoAnterior, double costoNuevo, int predecesor) {
+    }
+
+    void adyacentesProcesados(int vertice) {
+    }
+};
+
+// Imprime cada iteración como lo hacía mostrarProcesoDijkstra.
+class TrazaDijkstra {
+private:
+    std::ostream &salida;
+    const EspacioConsulta &espacio;
+    int cantidadVertices;
+    int iteracion;
+
+    void imprimirCostos() const;
+
+public:
+    TrazaDijkstra(std::ostream &salida, const EspacioConsulta &espacio, int cantidadVertices);
+
+    void verticeCerrado(int vertice, double costo);
+
+    void verticeMejorado(int vertice, double costoAnterior, double costoNuevo, int predecesor);
+
+    void adyacentesProcesados(int vertice);
+};
+
+// Dijkstra con montículo sobre cualquier grafo que exponga cantidadVertices() y
+// adyacentesDe(int). Política, parada, visitante y filtro se resuelven al compilar:
+// la versión sin traza ni filtro no paga nada por los ganchos. Los resultados quedan
+// en 'espacio'; los vértices y arcos que el filtro rechaza no se recorren.
+template<typename Grafo, typename Politica = PesoDistancia, typename Parada = SinParada,
+    typename Visitante = VisitanteNulo, typename Filtro = SinFiltro>
+void buscarCaminos(const Grafo &grafo, int origen, EspacioConsulta &espacio, Politica peso = Politica(),
+                   Parada parada = Parada(), Visitante &&visitante = Visitante(), const Filtro &filtro = Filtro());
+
+// Varios orígenes a costo 0: cada vértice queda con el costo desde el origen más cercano.
+template<typename Grafo, typename Politica = PesoDistancia, typename Parada = SinParada,
+    typename Visitante = VisitanteNulo, typename Filtro = SinFiltro>
+void buscarCaminos(const Grafo &grafo, std::span<const int> origenes, EspacioConsulta &espacio,
+                   Politica peso = Politica(), Parada parada = Parada(), Visitante &&visitante = Visitante(),
+                   const Filtro &filtro = Filtro());
+
+#endif //BUSQUEDACAMINOS_H
+#include "BusquedaCaminos.tpp"
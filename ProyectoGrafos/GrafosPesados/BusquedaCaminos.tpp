@@ -0,0 +1,51 @@
+#pragma once
+#include <stdexcept>
+#include <utility>
+
+template<typename Grafo, typename Politica, typename Parada, typename Visitante, typename Filtro>
+void buscarCaminos(const Grafo &grafo, std::span<const int> origenes, EspacioConsulta &espacio, Politica peso,
+                   Parada parada, Visitante &&visitante, const Filtro &filtro) {
+    espacio.preparar(grafo.cantidadVertices());
+    for (int origen: origenes) {
+        if (origen < 0 || origen >= grafo.cantidadVertices())
+            throw std::invalid_argument("Vertice de origen invalido");
+        if (!filtro.permiteVertice(origen)) continue;
+        espacio.relajar(origen, 0, EspacioConsulta::SIN_PREDECESOR);
+        espacio.insertarEnMonticulo(0, origen);
+    }
+
+    while (!espacio.monticuloVacio()) {
+        auto [costo, verticeActual] = espacio.extraerMinimo();
+        // Entrada obsoleta: el vértice ya se cerró con un costo menor
+        if (espacio.estaCerrado(verticeActual)) continue;
+        espacio.cerrar(verticeActual);
+        visitante.verticeCerrado(verticeActual, costo);
+
+        if (parada(verticeActual, costo)) return;
+
+        for (const auto &adyacente: grafo.adyacentesDe(verticeActual)) {
+            int vecino = adyacente.indiceVertice;
+            if (espacio.estaCerrado(vecino)) continue;
+            if (!filtro.permiteVertice(vecino) || !filtro.permiteArco(verticeActual, adyacente)) continue;
+
+            double nuevoCosto = costo + peso(adyacente);
+            if constexpr (requires { parada.podar(nuevoCosto); }) {
+                if (parada.podar(nuevoCosto)) continue;
+            }
+
+            double costoAnterior = espacio.getCosto(vecino);
+            if (espacio.relajar(vecino, nuevoCosto, verticeActual)) {
+                espacio.insertarEnMonticulo(nuevoCosto, vecino);
+                visitante.verticeMejorado(vecino, costoAnterior, nuevoCosto, verticeActual);
+            }
+        }
+        visitante.adyacentesProcesados(verticeActual);
+    }
+}
+
+template<typename Grafo, typename Politica, typename Parada, typename Visitante, typename Filtro>
+void buscarCaminos(const Grafo &grafo, int origen, EspacioConsulta &espacio, Politica peso, Parada parada,
+                   Visitante &&visitante, const Filtro &filtro) {
+    buscarCaminos(grafo, std::span<const int>(&origen, 1), espacio, peso, parada,
+                  std::forward<Visitante>(visitante), filtro);
+}
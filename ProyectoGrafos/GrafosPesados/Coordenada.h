@@ -0,0 +1,37 @@
+#ifndef COORDENADA_H
+#define COORDENADA_H
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Posición geográfica de un vértice en grados decimales.
+struct Coordenada {
+    double latitud;
+    double longitud;
+
+    Coordenada() : latitud(std::numeric_limits<double>::quiet_NaN()),
+                   longitud(std::numeric_limits<double>::quiet_NaN()) {
+    }
+
+    Coordenada(double latitud, double longitud) : latitud(latitud), longitud(longitud) {
+    }
+
+    bool esValida() const {
+        return !std::isnan(latitud) && !std::isnan(longitud);
+    }
+};
+
+// Radio medio de la Tierra (IUGG).
+constexpr double RADIO_TIERRA_KM = 6371.0088;
+
+// Distancia de gran círculo por la fórmula del haversine.
+inline double distanciaKilometros(const Coordenada &a, const Coordenada &b) {
+    constexpr double RADIANES = 3.14159265358979323846 / 180;
+    double senoLatitud = std::sin((b.latitud - a.latitud) * RADIANES / 2);
+    double senoLongitud = std::sin((b.longitud - a.longitud) * RADIANES / 2);
+    double h = senoLatitud * senoLatitud +
+               std::cos(a.latitud * RADIANES) * std::cos(b.latitud * RADIANES) * senoLongitud * senoLongitud;
+    return 2 * RADIO_TIERRA_KM * std::asin(std::sqrt(std::min(1.0, h)));
+}
+
+#endif //COORDENADA_H
@@ -8,11 +8,16 @@
 
 template<typename T>
 class DiGrafoPesado : public GrafoPesado<T> {
+protected:
+    void desconectarVertice(int nroVertice) override;
+
 public:
     DiGrafoPesado();
 
     explicit DiGrafoPesado(const std::vector<T> &vertices);
 
+    bool esDirigido() const override { return true; }
+
     void insertarArista(const T &origen, const T &destino) override;
 
     void insertarArista(const T &origen, const T &destino, double distancia, double tiempo) override;
@@ -23,6 +28,8 @@ public:
 
     [[nodiscard]] int cantidadAristas() const override;
 
+    bool esConexo() override;
+
     int gradoEntrada(const T &vertice) const;
 
     int gradoSalida(const T &vertice) const;
@@ -2,6 +2,8 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "utils/Componentes.h"
+
 template<typename T>
 DiGrafoPesado<T>::DiGrafoPesado() = default;
 
@@ -27,6 +29,12 @@ void DiGrafoPesado<T>::insertarArista(const T &origen, const T &destino, double
 
     this->listaAdyacencia[nroDeOrigen].push_back(AdyacenteConPeso(nroDeDestino, distancia, tiempo)
     );
+    if (this->idsEstables)
+        this->listaEntrantes[nroDeDestino].push_back(nroDeOrigen);
+    this->registrarConexion(nroDeOrigen, nroDeDestino);
+    this->observadores.notificar([&](auto &observador) {
+        observador.aristaInsertada(nroDeOrigen, nroDeDestino, distancia, tiempo);
+    });
 }
 
 template<typename T>
@@ -46,6 +54,31 @@ void DiGrafoPesado<T>::eliminarArista(const T &origen, const T &destino) {
                            return adyacente.indiceVertice == nroDeDestino;
                        }),
         this->listaAdyacencia[nroDeOrigen].end());
+    if (this->idsEstables) {
+        auto &entrantes = this->listaEntrantes[nroDeDestino];
+        entrantes.erase(std::remove(entrantes.begin(), entrantes.end(), nroDeOrigen), entrantes.end());
+    }
+    this->componentesVigentes = false;
+    this->observadores.notificar([&](auto &observador) { observador.aristaEliminada(nroDeOrigen, nroDeDestino); });
+}
+
+template<typename T>
+void DiGrafoPesado<T>::desconectarVertice(int nroVertice) {
+    // Con el índice inverso sólo se visitan los vecinos del vértice, no todo el grafo.
+    for (const auto &adyacente: this->listaAdyacencia[nroVertice]) {
+        auto &entrantes = this->listaEntrantes[adyacente.indiceVertice];
+        entrantes.erase(std::remove(entrantes.begin(), entrantes.end(), nroVertice), entrantes.end());
+    }
+    for (int predecesor: this->listaEntrantes[nroVertice]) {
+        auto &salientes = this->listaAdyacencia[predecesor];
+        salientes.erase(std::remove_if(salientes.begin(), salientes.end(),
+                                       [nroVertice](const AdyacenteConPeso &adyacente) {
+                                           return adyacente.indiceVertice == nroVertice;
+                                       }),
+                        salientes.end());
+    }
+    this->listaAdyacencia[nroVertice].clear();
+    this->listaEntrantes[nroVertice].clear();
 }
 
 template<typename T>
@@ -62,10 +95,21 @@ int DiGrafoPesado<T>::cantidadAristas() const {
     return cantidadAristas;
 }
 
+template<typename T>
+bool DiGrafoPesado<T>::esConexo() {
+    // Sin conexidad débil no puede haber conexidad fuerte; eso se responde sin Tarjan.
+    if (this->cantidadComponentes() > 1)
+        return false;
+    return componentesFuertementeConexas(*this).cantidad <= 1;
+}
+
 template<typename T>
 int DiGrafoPesado<T>::gradoEntrada(const T &vertice) const {
     this->validarVertice(vertice);
     int nroDeVertice = this->getNroVertice(vertice);
+    if (this->idsEstables)
+        return this->listaEntrantes[nroDeVertice].size();
+
     int gradoEntrada = 0;
     for (const auto &adyacentes: this->listaAdyacencia) {
         for (const auto &adyacente: adyacentes) {
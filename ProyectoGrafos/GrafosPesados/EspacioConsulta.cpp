@@ -0,0 +1,6 @@
+#include "EspacioConsulta.h"
+
+EspacioConsulta &EspacioConsulta::delHilo() {
+    thread_local EspacioConsulta espacio;
+    return espacio;
+}
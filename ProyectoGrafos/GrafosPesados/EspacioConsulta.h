@@ -0,0 +1,123 @@
+#ifndef ESPACIOCONSULTA_H
+#define ESPACIOCONSULTA_H
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Marcado.h"
+
+// Estado reutilizable de una búsqueda de caminos (costos, predecesores, montículo).
+// preparar() no reinicializa los arreglos: las épocas de MarcadoEpoca invalidan en
+// O(1) los valores de la consulta anterior y la lista de tocados permite recorrer
+// sólo los vértices que la búsqueda alcanzó. Un espacio no debe usarse en dos
+// búsquedas a la vez; delHilo() entrega uno por hilo.
+class EspacioConsulta {
+public:
+    static constexpr double INFINITO = 1e10;
+    static constexpr int SIN_PREDECESOR = -1;
+
+private:
+    using EntradaMonticulo = std::pair<double, int>;
+
+    std::vector<double> costos;
+    std::vector<int> predecesores;
+    MarcadoEpoca alcanzados;
+    MarcadoEpoca cerrados;
+    std::vector<int> tocados;
+    std::vector<EntradaMonticulo> monticulo;
+
+public:
+    void preparar(int cantidadVertices) {
+        if (cantidadVertices > costos.size()) {
+            costos.resize(cantidadVertices);
+            predecesores.resize(cantidadVertices);
+            alcanzados.redimensionar(cantidadVertices);
+            cerrados.redimensionar(cantidadVertices);
+        }
+        alcanzados.reiniciar();
+        cerrados.reiniciar();
+        tocados.clear();
+        monticulo.clear();
+    }
+
+    double getCosto(int vertice) const {
+        return alcanzados.estaMarcado(vertice) ? costos[vertice] : INFINITO;
+    }
+
+    int getPredecesor(int vertice) const {
+        return alcanzados.estaMarcado(vertice) ? predecesores[vertice] : SIN_PREDECESOR;
+    }
+
+    bool fueAlcanzado(int vertice) const {
+        return alcanzados.estaMarcado(vertice);
+    }
+
+    bool estaCerrado(int vertice) const {
+        return cerrados.estaMarcado(vertice);
+    }
+
+    void cerrar(int vertice) {
+        cerrados.marcar(vertice);
+    }
+
+    // Asigna el costo si mejora el actual; devuelve true si hubo mejora. Ante un
+    // empate se queda con el predecesor de menor índice, así el árbol de caminos no
+    // depende del orden de exploración.
+    bool relajar(int vertice, double costo, int predecesor) {
+        if (!alcanzados.estaMarcado(vertice)) {
+            alcanzados.marcar(vertice);
+            tocados.push_back(vertice);
+        } else if (costo >= costos[vertice]) {
+            if (costo == costos[vertice] && predecesor < predecesores[vertice])
+                predecesores[vertice] = predecesor;
+            return false;
+        }
+        costos[vertice] = costo;
+        predecesores[vertice] = predecesor;
+        return true;
+    }
+
+    void insertarEnMonticulo(double costo, int vertice) {
+        monticulo.emplace_back(costo, vertice);
+        std::push_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+    }
+
+    bool monticuloVacio() const {
+        return monticulo.empty();
+    }
+
+    EntradaMonticulo extraerMinimo() {
+        std::pop_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+        EntradaMonticulo minimo = monticulo.back();
+        monticulo.pop_back();
+        return minimo;
+    }
+
+    const std::vector<int> &getTocados() const {
+        return tocados;
+    }
+
+    // Vector denso de costos (INFINITO si no se alcanzó); O(V).
+    std::vector<double> costosCompletos(int cantidadVertices) const {
+        std::vector<double> resultado(cantidadVertices, INFINITO);
+        for (int vertice: tocados)
+            resultado[vertice] = costos[vertice];
+        return resultado;
+    }
+
+    // Índices del camino desde el origen hasta 'destino'; vacío si no se alcanzó.
+    std::vector<int> reconstruirCamino(int destino) const {
+        std::vector<int> camino;
+        if (!fueAlcanzado(destino))
+            return camino;
+        for (int actual = destino; actual != SIN_PREDECESOR; actual = predecesores[actual])
+            camino.push_back(actual);
+        std::reverse(camino.begin(), camino.end());
+        return camino;
+    }
+
+    static EspacioConsulta &delHilo();
+};
+
+#endif //ESPACIOCONSULTA_H
@@ -0,0 +1,47 @@
+#include "FiltroBusqueda.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+bool FiltroBusqueda::arcoBloqueado(int origen, int destino) const {
+    return std::binary_search(arcosBloqueados.begin(), arcosBloqueados.end(), claveArco(origen, destino));
+}
+
+void FiltroBusqueda::bloquearVertice(int vertice) {
+    if (vertice < 0)
+        throw std::invalid_argument("Vertice invalido");
+    size_t palabra = static_cast<size_t>(vertice) >> 6;
+    if (palabra >= verticesBloqueados.size())
+        verticesBloqueados.resize(palabra + 1, 0);
+    verticesBloqueados[palabra] |= uint64_t(1) << (vertice & 63);
+}
+
+void FiltroBusqueda::desbloquearVertice(int vertice) {
+    size_t palabra = static_cast<size_t>(vertice) >> 6;
+    if (vertice >= 0 && palabra < verticesBloqueados.size())
+        verticesBloqueados[palabra] &= ~(uint64_t(1) << (vertice & 63));
+}
+
+void FiltroBusqueda::bloquearArco(int origen, int destino) {
+    if (origen < 0 || destino < 0)
+        throw std::invalid_argument("Vertice invalido");
+    uint64_t clave = claveArco(origen, destino);
+    auto posicion = std::lower_bound(arcosBloqueados.begin(), arcosBloqueados.end(), clave);
+    if (posicion == arcosBloqueados.end() || *posicion != clave)
+        arcosBloqueados.insert(posicion, clave);
+}
+
+void FiltroBusqueda::bloquearArista(int origen, int destino) {
+    bloquearArco(origen, destino);
+    bloquearArco(destino, origen);
+}
+
+void FiltroBusqueda::setPredicado(Predicado predicado) {
+    this->predicado = std::move(predicado);
+}
+
+void FiltroBusqueda::limpiar() {
+    verticesBloqueados.clear();
+    arcosBloqueados.clear();
+    predicado = nullptr;
+}
@@ -0,0 +1,89 @@
+#ifndef FILTROBUSQUEDA_H
+#define FILTROBUSQUEDA_H
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "AdyacenteConPeso.h"
+
+// Filtro vacío por defecto: el compilador elimina las consultas.
+struct SinFiltro {
+    bool permiteVertice(int vertice) const {
+        return true;
+    }
+
+    bool permiteArco(int origen, const AdyacenteConPeso &arco) const {
+        return true;
+    }
+};
+
+// Restricciones de una consulta sin tocar el grafo: vértices bloqueados (bitset),
+// arcos bloqueados y un predicado opcional sobre los arcos. Las búsquedas sólo lo
+// leen, así que un mismo filtro puede compartirse entre hilos de un lote.
+class FiltroBusqueda {
+public:
+    using Predicado = std::function<bool(int origen, const AdyacenteConPeso &arco)>;
+
+private:
+    std::vector<uint64_t> verticesBloqueados;
+    // Claves origen:destino ordenadas para búsqueda binaria.
+    std::vector<uint64_t> arcosBloqueados;
+    Predicado predicado;
+
+    static uint64_t claveArco(int origen, int destino) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(origen)) << 32 | static_cast<uint32_t>(destino);
+    }
+
+    bool arcoBloqueado(int origen, int destino) const;
+
+public:
+    void bloquearVertice(int vertice);
+
+    void desbloquearVertice(int vertice);
+
+    // Bloquea sólo el sentido origen -> destino.
+    void bloquearArco(int origen, int destino);
+
+    // Bloquea ambos sentidos, como una arista de un grafo no dirigido.
+    void bloquearArista(int origen, int destino);
+
+    // El arco se usa sólo si el predicado devuelve true.
+    void setPredicado(Predicado predicado);
+
+    void limpiar();
+
+    bool permiteVertice(int vertice) const {
+        size_t palabra = static_cast<size_t>(vertice) >> 6;
+        return palabra >= verticesBloqueados.size() || !(verticesBloqueados[palabra] >> (vertice & 63) & 1);
+    }
+
+    bool permiteArco(int origen, const AdyacenteConPeso &arco) const {
+        if (!arcosBloqueados.empty() && arcoBloqueado(origen, arco.indiceVertice))
+            return false;
+        return !predicado || predicado(origen, arco);
+    }
+};
+
+// Adapta un filtro a una búsqueda sobre el grafo transpuesto: el arco v -> u del
+// transpuesto es el arco u -> v del grafo original.
+template<typename Filtro>
+class FiltroInverso {
+private:
+    const Filtro &filtro;
+
+public:
+    explicit FiltroInverso(const Filtro &filtro) : filtro(filtro) {
+    }
+
+    bool permiteVertice(int vertice) const {
+        return filtro.permiteVertice(vertice);
+    }
+
+    bool permiteArco(int origen, const AdyacenteConPeso &arco) const {
+        AdyacenteConPeso directo = arco;
+        directo.indiceVertice = origen;
+        return filtro.permiteArco(arco.indiceVertice, directo);
+    }
+};
+
+#endif //FILTROBUSQUEDA_H
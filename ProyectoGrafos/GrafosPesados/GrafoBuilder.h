@@ -0,0 +1,68 @@
+#ifndef GRAFOBUILDER_H
+#define GRAFOBUILDER_H
+#include <map>
+#include <vector>
+
+#include "GrafoCompacto.h"
+#include "utils/Paralelo.h"
+
+enum class PoliticaDuplicados {
+    MANTENER_MINIMO, // conserva la arista de menor distancia (desempata por tiempo)
+    MANTENER_ULTIMO, // conserva la última arista agregada
+    ERROR            // lanza std::invalid_argument
+};
+
+// Acumula vértices y aristas en buffers planos y construye el grafo de una sola vez:
+// un ordenamiento paralelo O(E log E) reemplaza la validación O(V) y el sort por
+// inserción de insertarArista. El builder queda vacío después de construir.
+template<typename T>
+class GrafoBuilder {
+    struct AristaPendiente {
+        int origen;
+        int destino;
+        double distancia;
+        double tiempo;
+        uint32_t capacidad;
+        size_t orden;
+    };
+
+private:
+    bool dirigido;
+    PoliticaDuplicados politica;
+    int hilos;
+    std::vector<T> vertices;
+    std::map<T, int> indiceVertices;
+    std::vector<AristaPendiente> aristas;
+
+    void ordenarYDepurar();
+
+    std::vector<int> calcularDesplazamientos() const;
+
+public:
+    explicit GrafoBuilder(bool dirigido = false, PoliticaDuplicados politica = PoliticaDuplicados::MANTENER_MINIMO,
+                          int hilos = cantidadHilos());
+
+    void reservar(size_t cantidadVertices, size_t cantidadAristas);
+
+    // Devuelve el número del vértice; si ya existía no lo duplica.
+    int agregarVertice(const T &vertice);
+
+    int getNroVertice(const T &vertice) const;
+
+    void agregarArista(int nroOrigen, int nroDestino, double distancia, double tiempo,
+                       uint32_t capacidad = AdyacenteConPeso::SIN_CAPACIDAD);
+
+    void agregarArista(const T &origen, const T &destino, double distancia, double tiempo,
+                       uint32_t capacidad = AdyacenteConPeso::SIN_CAPACIDAD);
+
+    int cantidadVertices() const;
+
+    size_t cantidadAristas() const;
+
+    void construirEn(GrafoPesado<T> &grafo);
+
+    GrafoCompacto<T> construirCompacto();
+};
+
+#endif
+#include "GrafoBuilder.tpp"
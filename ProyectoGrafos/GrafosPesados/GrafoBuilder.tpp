@@ -0,0 +1,143 @@
+#pragma once
+#include <stdexcept>
+#include <string>
+
+template<typename T>
+GrafoBuilder<T>::GrafoBuilder(bool dirigido, PoliticaDuplicados politica, int hilos)
+    : dirigido(dirigido), politica(politica), hilos(hilos) {
+}
+
+template<typename T>
+void GrafoBuilder<T>::reservar(size_t cantidadVertices, size_t cantidadAristas) {
+    vertices.reserve(cantidadVertices);
+    aristas.reserve(cantidadAristas);
+}
+
+template<typename T>
+int GrafoBuilder<T>::agregarVertice(const T &vertice) {
+    auto [it, insertado] = indiceVertices.emplace(vertice, static_cast<int>(vertices.size()));
+    if (insertado)
+        vertices.push_back(vertice);
+    return it->second;
+}
+
+template<typename T>
+int GrafoBuilder<T>::getNroVertice(const T &vertice) const {
+    auto it = indiceVertices.find(vertice);
+    return it == indiceVertices.end() ? GrafoPesado<T>::NRO_VERTICE_INVALIDO : it->second;
+}
+
+template<typename T>
+void GrafoBuilder<T>::agregarArista(int nroOrigen, int nroDestino, double distancia, double tiempo,
+                                    uint32_t capacidad) {
+    if (!dirigido && nroDestino < nroOrigen)
+        std::swap(nroOrigen, nroDestino);
+    aristas.push_back({nroOrigen, nroDestino, distancia, tiempo, capacidad, aristas.size()});
+}
+
+template<typename T>
+void GrafoBuilder<T>::agregarArista(const T &origen, const T &destino, double distancia, double tiempo,
+                                    uint32_t capacidad) {
+    int nroOrigen = getNroVertice(origen);
+    int nroDestino = getNroVertice(destino);
+    if (nroOrigen == GrafoPesado<T>::NRO_VERTICE_INVALIDO || nroDestino == GrafoPesado<T>::NRO_VERTICE_INVALIDO)
+        throw std::invalid_argument("El vertice no existe");
+    agregarArista(nroOrigen, nroDestino, distancia, tiempo, capacidad);
+}
+
+template<typename T>
+int GrafoBuilder<T>::cantidadVertices() const {
+    return vertices.size();
+}
+
+template<typename T>
+size_t GrafoBuilder<T>::cantidadAristas() const {
+    return aristas.size();
+}
+
+template<typename T>
+void GrafoBuilder<T>::ordenarYDepurar() {
+    int n = cantidadVertices();
+    for (const auto &arista: aristas) {
+        if (arista.origen < 0 || arista.origen >= n || arista.destino < 0 || arista.destino >= n)
+            throw std::out_of_range("Arista con vertice fuera de rango");
+    }
+
+    ordenarParalelo(aristas.begin(), aristas.end(), [](const AristaPendiente &a, const AristaPendiente &b) {
+        if (a.origen != b.origen) return a.origen < b.origen;
+        if (a.destino != b.destino) return a.destino < b.destino;
+        return a.orden < b.orden;
+    }, hilos);
+
+    size_t escritura = 0;
+    for (size_t i = 0; i < aristas.size();) {
+        size_t j = i + 1;
+        AristaPendiente elegida = aristas[i];
+        while (j < aristas.size() && aristas[j].origen == elegida.origen && aristas[j].destino == elegida.destino) {
+            const AristaPendiente &candidata = aristas[j];
+            switch (politica) {
+                case PoliticaDuplicados::MANTENER_MINIMO:
+                    if (candidata.distancia < elegida.distancia ||
+                        (candidata.distancia == elegida.distancia && candidata.tiempo < elegida.tiempo))
+                        elegida = candidata;
+                    break;
+                case PoliticaDuplicados::MANTENER_ULTIMO:
+                    elegida = candidata;
+                    break;
+                case PoliticaDuplicados::ERROR:
+                    throw std::invalid_argument("Arista duplicada: " + std::to_string(elegida.origen) + " - " +
+                                                std::to_string(elegida.destino));
+            }
+            j++;
+        }
+        aristas[escritura++] = elegida;
+        i = j;
+    }
+    aristas.resize(escritura);
+}
+
+template<typename T>
+std::vector<int> GrafoBuilder<T>::calcularDesplazamientos() const {
+    int n = cantidadVertices();
+    std::vector<int> desplazamientos(n + 1, 0);
+    for (const auto &arista: aristas) {
+        desplazamientos[arista.origen + 1]++;
+        if (!dirigido && arista.origen != arista.destino)
+            desplazamientos[arista.destino + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+        desplazamientos[v + 1] += desplazamientos[v];
+    return desplazamientos;
+}
+
+template<typename T>
+GrafoCompacto<T> GrafoBuilder<T>::construirCompacto() {
+    ordenarYDepurar();
+    std::vector<int> desplazamientos = calcularDesplazamientos();
+
+    // Las aristas están ordenadas por (origen, destino); en el caso no dirigido los arcos
+    // inversos de v (origen < v) llegan antes que sus arcos directos, así que cada lista
+    // queda ordenada por índice de vecino como en GrafoPesado::insertarArista.
+    std::vector<int> posiciones(desplazamientos.begin(), desplazamientos.end() - 1);
+    std::vector<AdyacenteConPeso> arcos(desplazamientos.back(), AdyacenteConPeso(0));
+    for (const auto &arista: aristas) {
+        arcos[posiciones[arista.origen]++] = AdyacenteConPeso(arista.destino, arista.distancia, arista.tiempo,
+                                                              arista.capacidad);
+        if (!dirigido && arista.origen != arista.destino)
+            arcos[posiciones[arista.destino]++] = AdyacenteConPeso(arista.origen, arista.distancia, arista.tiempo,
+                                                                   arista.capacidad);
+    }
+
+    GrafoCompacto<T> compacto(std::move(vertices), std::move(desplazamientos), std::move(arcos), dirigido);
+    vertices.clear();
+    indiceVertices.clear();
+    aristas.clear();
+    return compacto;
+}
+
+template<typename T>
+void GrafoBuilder<T>::construirEn(GrafoPesado<T> &grafo) {
+    if (grafo.esDirigido() != dirigido)
+        throw std::invalid_argument("El tipo de grafo no coincide con el del builder");
+    construirCompacto().volcarEn(grafo);
+}
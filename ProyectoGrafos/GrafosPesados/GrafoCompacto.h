@@ -0,0 +1,55 @@
+#ifndef GRAFOCOMPACTO_H
+#define GRAFOCOMPACTO_H
+#include <span>
+#include <vector>
+
+#include "GrafoPesado.h"
+
+// Instantánea inmutable en formato CSR: los adyacentes del vértice v ocupan
+// arcos[desplazamientos[v], desplazamientos[v + 1]). En un grafo no dirigido
+// cada arista aparece en ambas direcciones, igual que en GrafoPesado.
+template<typename T>
+class GrafoCompacto {
+private:
+    std::vector<T> vertices;
+    std::vector<int> desplazamientos;
+    std::vector<AdyacenteConPeso> arcos;
+    bool dirigido;
+
+public:
+    GrafoCompacto();
+
+    GrafoCompacto(std::vector<T> vertices, std::vector<int> desplazamientos, std::vector<AdyacenteConPeso> arcos,
+                  bool dirigido);
+
+    static GrafoCompacto desdeGrafo(const GrafoPesado<T> &grafo);
+
+    void volcarEn(GrafoPesado<T> &grafo) const;
+
+    GrafoCompacto transpuesto() const;
+
+    int cantidadVertices() const { return static_cast<int>(vertices.size()); }
+
+    int cantidadArcos() const { return static_cast<int>(arcos.size()); }
+
+    bool esDirigido() const { return dirigido; }
+
+    std::span<const AdyacenteConPeso> adyacentesDe(int nroVertice) const {
+        return {arcos.data() + desplazamientos[nroVertice], arcos.data() + desplazamientos[nroVertice + 1]};
+    }
+
+    int inicioArcos(int nroVertice) const { return desplazamientos[nroVertice]; }
+
+    int finArcos(int nroVertice) const { return desplazamientos[nroVertice + 1]; }
+
+    const T &getVertice(int nroVertice) const { return vertices[nroVertice]; }
+
+    const std::vector<T> &getVertices() const { return vertices; }
+
+    const std::vector<int> &getDesplazamientos() const { return desplazamientos; }
+
+    const std::vector<AdyacenteConPeso> &getArcos() const { return arcos; }
+};
+
+#endif
+#include "GrafoCompacto.tpp"
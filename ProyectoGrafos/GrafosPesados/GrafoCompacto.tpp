@@ -0,0 +1,82 @@
+#pragma once
+#include <stdexcept>
+
+template<typename T>
+GrafoCompacto<T>::GrafoCompacto() : desplazamientos(1, 0), dirigido(false) {
+}
+
+template<typename T>
+GrafoCompacto<T>::GrafoCompacto(std::vector<T> vertices, std::vector<int> desplazamientos,
+                                std::vector<AdyacenteConPeso> arcos, bool dirigido)
+    : vertices(std::move(vertices)), desplazamientos(std::move(desplazamientos)), arcos(std::move(arcos)),
+      dirigido(dirigido) {
+    if (this->desplazamientos.size() != this->vertices.size() + 1 ||
+        this->desplazamientos.back() != static_cast<int>(this->arcos.size()))
+        throw std::invalid_argument("Desplazamientos CSR inconsistentes");
+}
+
+template<typename T>
+GrafoCompacto<T> GrafoCompacto<T>::desdeGrafo(const GrafoPesado<T> &grafo) {
+    // Las lápidas del modo de ids estables no pasan a la instantánea.
+    int n = grafo.cantidadVertices();
+    std::vector<int> renumeracion(n);
+    std::vector<T> vertices;
+    vertices.reserve(grafo.cantidadVerticesActivos());
+    for (int v = 0; v < n; v++) {
+        renumeracion[v] = grafo.estaEliminado(v) ? GrafoPesado<T>::NRO_VERTICE_INVALIDO : vertices.size();
+        if (!grafo.estaEliminado(v))
+            vertices.push_back(grafo.getVertices()[v]);
+    }
+
+    std::vector<int> desplazamientos(vertices.size() + 1, 0);
+    std::vector<AdyacenteConPeso> arcos;
+    for (int v = 0; v < n; v++) {
+        if (renumeracion[v] == GrafoPesado<T>::NRO_VERTICE_INVALIDO)
+            continue;
+        for (AdyacenteConPeso arco: grafo.adyacentesDe(v)) {
+            arco.indiceVertice = renumeracion[arco.indiceVertice];
+            arcos.push_back(arco);
+        }
+        desplazamientos[renumeracion[v] + 1] = arcos.size();
+    }
+
+    return GrafoCompacto(std::move(vertices), std::move(desplazamientos), std::move(arcos), grafo.esDirigido());
+}
+
+template<typename T>
+void GrafoCompacto<T>::volcarEn(GrafoPesado<T> &grafo) const {
+    if (grafo.esDirigido() != dirigido)
+        throw std::invalid_argument("El tipo de grafo no coincide con la instantanea");
+
+    std::vector<std::vector<AdyacenteConPeso> > adyacencia(vertices.size());
+    for (int v = 0; v < cantidadVertices(); v++) {
+        auto adyacentes = adyacentesDe(v);
+        adyacencia[v].assign(adyacentes.begin(), adyacentes.end());
+    }
+    grafo.cargarMasivo(vertices, std::move(adyacencia));
+}
+
+template<typename T>
+GrafoCompacto<T> GrafoCompacto<T>::transpuesto() const {
+    if (!dirigido)
+        return *this;
+
+    int n = cantidadVertices();
+    std::vector<int> nuevosDesplazamientos(n + 1, 0);
+    for (const auto &arco: arcos)
+        nuevosDesplazamientos[arco.indiceVertice + 1]++;
+    for (int v = 0; v < n; v++)
+        nuevosDesplazamientos[v + 1] += nuevosDesplazamientos[v];
+
+    std::vector<int> posiciones(nuevosDesplazamientos.begin(), nuevosDesplazamientos.end() - 1);
+    std::vector<AdyacenteConPeso> nuevosArcos(arcos.size(), AdyacenteConPeso(0));
+    for (int v = 0; v < n; v++) {
+        for (const auto &arco: adyacentesDe(v)) {
+            AdyacenteConPeso inverso = arco;
+            inverso.indiceVertice = v;
+            nuevosArcos[posiciones[arco.indiceVertice]++] = inverso;
+        }
+    }
+
+    return GrafoCompacto(vertices, std::move(nuevosDesplazamientos), std::move(nuevosArcos), true);
+}
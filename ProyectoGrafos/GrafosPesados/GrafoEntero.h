@@ -0,0 +1,70 @@
+#ifndef GRAFOENTERO_H
+#define GRAFOENTERO_H
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "GrafoCompacto.h"
+
+// Arco con pesos enteros: 12 bytes frente a los 24 de AdyacenteConPeso.
+struct ArcoEntero {
+    uint32_t indiceVertice;
+    uint32_t metros;
+    uint32_t segundos;
+};
+
+// Variante CSR de GrafoCompacto con pesos enteros (metros y segundos). Los números
+// de vértice coinciden con los del GrafoCompacto de origen.
+template<typename T>
+class GrafoEntero {
+public:
+    static constexpr uint64_t INFINITO = std::numeric_limits<uint64_t>::max();
+    // Factores por defecto: kilómetros -> metros, horas -> segundos.
+    static constexpr double METROS_POR_UNIDAD = 1000;
+    static constexpr double SEGUNDOS_POR_UNIDAD = 3600;
+
+private:
+    std::vector<T> vertices;
+    std::vector<int> desplazamientos;
+    std::vector<ArcoEntero> arcos;
+    bool dirigido;
+    double factorDistancia;
+    double factorTiempo;
+
+    static uint32_t redondear(double valor, double factor);
+
+public:
+    GrafoEntero();
+
+    static GrafoEntero desdeCompacto(const GrafoCompacto<T> &compacto, double factorDistancia = METROS_POR_UNIDAD,
+                                     double factorTiempo = SEGUNDOS_POR_UNIDAD);
+
+    int cantidadVertices() const { return static_cast<int>(vertices.size()); }
+
+    int cantidadArcos() const { return static_cast<int>(arcos.size()); }
+
+    bool esDirigido() const { return dirigido; }
+
+    std::span<const ArcoEntero> adyacentesDe(int nroVertice) const {
+        return {arcos.data() + desplazamientos[nroVertice], arcos.data() + desplazamientos[nroVertice + 1]};
+    }
+
+    const T &getVertice(int nroVertice) const { return vertices[nroVertice]; }
+
+    // Arco con los pesos devueltos a las unidades originales (redondeados y sin
+    // capacidad), para consultar filtros pensados para AdyacenteConPeso.
+    AdyacenteConPeso comoAdyacente(const ArcoEntero &arco) const {
+        return AdyacenteConPeso(arco.indiceVertice, arco.metros / factorDistancia, arco.segundos / factorTiempo);
+    }
+
+    const std::vector<T> &getVertices() const { return vertices; }
+
+    // Memoria de la estructura CSR sin contar los vértices.
+    size_t bytesTopologia() const {
+        return desplazamientos.size() * sizeof(int) + arcos.size() * sizeof(ArcoEntero);
+    }
+};
+
+#endif
+#include "GrafoEntero.tpp"
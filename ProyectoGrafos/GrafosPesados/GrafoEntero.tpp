@@ -0,0 +1,35 @@
+#pragma once
+#include <cmath>
+#include <stdexcept>
+
+template<typename T>
+GrafoEntero<T>::GrafoEntero()
+    : desplazamientos(1, 0), dirigido(false), factorDistancia(METROS_POR_UNIDAD), factorTiempo(SEGUNDOS_POR_UNIDAD) {
+}
+
+template<typename T>
+uint32_t GrafoEntero<T>::redondear(double valor, double factor) {
+    double escalado = std::round(valor * factor);
+    if (!(escalado >= 0) || escalado > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("Peso fuera del rango entero: " + std::to_string(valor));
+    return static_cast<uint32_t>(escalado);
+}
+
+template<typename T>
+GrafoEntero<T> GrafoEntero<T>::desdeCompacto(const GrafoCompacto<T> &compacto, double factorDistancia,
+                                             double factorTiempo) {
+    GrafoEntero resultado;
+    resultado.vertices = compacto.getVertices();
+    resultado.desplazamientos = compacto.getDesplazamientos();
+    resultado.dirigido = compacto.esDirigido();
+    resultado.factorDistancia = factorDistancia;
+    resultado.factorTiempo = factorTiempo;
+
+    resultado.arcos.reserve(compacto.cantidadArcos());
+    for (const auto &arco: compacto.getArcos()) {
+        resultado.arcos.push_back({static_cast<uint32_t>(arco.indiceVertice),
+                                   redondear(arco.distancia, factorDistancia),
+                                   redondear(arco.tiempo, factorTiempo)});
+    }
+    return resultado;
+}
@@ -1,43 +1,75 @@
 #ifndef GRAFOPESADO_H
 #define GRAFOPESADO_H
+#include <atomic>
+#include <mutex>
 #include <queue>
 #include <vector>
 #include <string>
 #include <map>
+#include <span>
+#include "AdyacenteConPeso.h"
 #include "Marcado.h"
+#include "EspacioConsulta.h"
+#include "BusquedaCaminos.h"
+#include "ObservadorGrafo.h"
+#include "utils/UnionFind.h"
+
+// Indica si las componentes del grafo están al día. La leen consultas const desde
+// varios hilos; al copiar el grafo se copia el valor pero no el mutex.
+class VigenciaComponentes {
+private:
+    std::atomic<bool> vigentes{true};
+    std::mutex mutex;
 
-struct AdyacenteConPeso {
-    int indiceVertice;
-    double distancia;
-    double tiempo;
+public:
+    VigenciaComponentes() = default;
 
-    explicit AdyacenteConPeso(int vertice) : indiceVertice(vertice), distancia(0), tiempo(0) {
+    VigenciaComponentes(const VigenciaComponentes &otra) : vigentes(otra.vigentes.load()) {
     }
 
-    AdyacenteConPeso(int vertice, double distancia, double tiempo) : indiceVertice(vertice), distancia(distancia),
-                                                                     tiempo(tiempo) {
+    VigenciaComponentes &operator=(const VigenciaComponentes &otra) {
+        vigentes = otra.vigentes.load();
+        return *this;
     }
 
-    bool operator<(const AdyacenteConPeso &otro) const {
-        return this->indiceVertice < otro.indiceVertice;
+    VigenciaComponentes &operator=(bool valor) {
+        vigentes = valor;
+        return *this;
     }
 
-    bool operator==(const AdyacenteConPeso &otro) const {
-        return this->indiceVertice == otro.indiceVertice;
-    }
+    operator bool() const { return vigentes; }
 
-    bool operator!=(const AdyacenteConPeso &otro) const {
-        return !(*this == otro);
-    }
+    std::mutex &getMutex() { return mutex; }
 };
 
-
-
 template<typename T>
 class GrafoPesado {
 protected:
     std::vector<T> listaVertices;
     std::vector<std::vector<AdyacenteConPeso> > listaAdyacencia;
+    ListaObservadores<T> observadores;
+    std::map<T, int> indiceVertices;
+
+    // Modo de ids estables: los vértices eliminados quedan como lápidas reutilizables.
+    bool idsEstables = false;
+    std::vector<bool> eliminados;
+    std::vector<int> posicionesLibres;
+    std::vector<std::vector<int> > listaEntrantes; // índice inverso, sólo en grafos dirigidos
+
+    // Componentes mantenidas al insertar aristas (débiles en grafos dirigidos). Unir
+    // cuesta O(α(n)) pero separar no se puede: las eliminaciones las dejan no vigentes
+    // y la siguiente consulta, aunque sea const, las reconstruye una sola vez.
+    mutable UnionFind componentes;
+    mutable VigenciaComponentes componentesVigentes;
+
+    void reconstruirIndices();
+
+    // Recalcula las componentes si no están vigentes; sólo un hilo lo hace.
+    void asegurarComponentes() const;
+
+    void registrarConexion(int nroOrigen, int nroDestino);
+
+    virtual void desconectarVertice(int nroVertice);
 
 public:
     static constexpr int NRO_VERTICE_INVALIDO = -1;
@@ -48,10 +80,29 @@ public:
 
     virtual ~GrafoPesado() = default;
 
+    virtual bool esDirigido() const { return false; }
+
+    void agregarObservador(ObservadorGrafo<T> *observador) { observadores.agregar(observador); }
+
+    void quitarObservador(ObservadorGrafo<T> *observador) { observadores.quitar(observador); }
+
+    // Reemplaza el contenido del grafo con listas ya validadas (carga masiva).
+    void cargarMasivo(std::vector<T> vertices, std::vector<std::vector<AdyacenteConPeso> > adyacencia);
+
     void insertarVertice(const T &vertice);
 
     void eliminarVertice(const T &vertice);
 
+    // Con ids estables eliminarVertice cuesta O(grado) y no renumera los demás vértices.
+    void activarIdsEstables();
+
+    bool tieneIdsEstables() const { return idsEstables; }
+
+    bool estaEliminado(int nroVertice) const;
+
+    // Renumera en bloque descartando las lápidas; devuelve nro anterior -> nro nuevo (-1 si se eliminó).
+    std::vector<int> compactar();
+
     virtual void insertarArista(const T &origen, const T &destino) { insertarArista(origen, destino, 0, 0); }
 
     virtual void insertarArista(const T &origen, const T &destino, double distancia, double tiempo);
@@ -60,8 +111,14 @@ public:
 
     double getPesoArista(const T &origen, const T &destino);
 
+    // En grafos no dirigidos el peso vale para ambos sentidos.
     void actualizarPesoArista(const T &origen, const T &destino, double distancia, double tiempo);
 
+    // En grafos no dirigidos la capacidad vale para ambos sentidos.
+    void setCapacidadArista(const T &origen, const T &destino, uint32_t capacidad);
+
+    uint32_t getCapacidadArista(const T &origen, const T &destino) const;
+
     virtual int grado(const T &vertice);
 
     bool existeAdyacencia(const T &origen, const T &destino) const;
@@ -70,24 +127,43 @@ public:
 
     int getNroVertice(const T &vertice) const;
 
+    // Indexado por número de vértice: en el modo de ids estables incluye las lápidas (T()).
     const std::vector<T> &getVertices() const;
 
+    // Sólo los vértices no eliminados, en orden de número.
+    std::vector<T> getVerticesActivos() const;
+
     double getTiempoArista(const T &origen, const T &destino) const;
 
     std::vector<T> getAdyacentesDelVertice(const T &vertice) const;
 
     std::vector<AdyacenteConPeso> getAdyacentesDelVerticeConPeso(const T &vertice) const;
 
+    std::span<const AdyacenteConPeso> adyacentesDe(int nroVertice) const;
+
     T getVertice(int pos) const;
 
     // Métodos de información
+    // Incluye las lápidas en el modo de ids estables.
     int cantidadVertices() const;
 
+    int cantidadVerticesActivos() const;
+
     virtual int cantidadAristas() const;
 
     double pesoTotal() const;
 
-    static bool esConexo();
+    void recalcularComponentes() const;
+
+    // Recalcula si las componentes no están vigentes. En grafos dirigidos son las débiles.
+    int cantidadComponentes();
+
+    // true sólo si los vértices están en componentes distintas: no hay camino entre ellos.
+    // Admite consultas concurrentes, pero no junto con mutaciones del grafo.
+    bool sonInalcanzables(int nroOrigen, int nroDestino) const;
+
+    // En grafos dirigidos exige conexidad fuerte.
+    virtual bool esConexo();
 
     std::string toString() const;
 
@@ -96,15 +172,25 @@ public:
 
     double obtenerTiempoDijkstra(const T &origen, const T &destino) const;
 
-    std::vector<double> dijkstra(const T &origen) const;
+    // El filtro (p. ej. FiltroBusqueda) permite excluir vértices o arcos sólo para esta
+    // consulta; con SinFiltro, el valor por defecto, las comprobaciones no se compilan.
+    template<typename Filtro = SinFiltro>
+    std::vector<double> dijkstra(const T &origen, const Filtro &filtro = Filtro()) const;
+
+    // Deja costos y predecesores por distancia en 'espacio'; no reserva memoria O(V) por consulta.
+    template<typename Filtro = SinFiltro>
+    void dijkstra(const T &origen, EspacioConsulta &espacio, const Filtro &filtro = Filtro()) const;
 
-    std::vector<T> obtenerCaminoTradicional(const T &origen, const T &destino) const;
+    template<typename Filtro = SinFiltro>
+    std::vector<T> obtenerCaminoTradicional(const T &origen, const T &destino, const Filtro &filtro = Filtro()) const;
 
-    double obtenerCostoMinimo(const T &origen, const T &destino) const;
+    template<typename Filtro = SinFiltro>
+    double obtenerCostoMinimo(const T &origen, const T &destino, const Filtro &filtro = Filtro()) const;
 
     void mostrarProcesoDijkstra(const T &origen) const;
 
-    double obtenerTiempoTradicional(const T &origen, const T &destino) const;
+    template<typename Filtro = SinFiltro>
+    double obtenerTiempoTradicional(const T &origen, const T &destino, const Filtro &filtro = Filtro()) const;
 
 };
 
@@ -21,14 +21,135 @@ template<typename T>
 void GrafoPesado<T>::insertarVertice(const T &vertice) {
     if (getNroVertice(vertice) != NRO_VERTICE_INVALIDO)
         throw std::invalid_argument("El vertice ya existe");
-    listaVertices.push_back(vertice);
-    listaAdyacencia.emplace_back();
+
+    int nroDeVertice;
+    if (idsEstables && !posicionesLibres.empty()) {
+        nroDeVertice = posicionesLibres.back();
+        posicionesLibres.pop_back();
+        listaVertices[nroDeVertice] = vertice;
+        eliminados[nroDeVertice] = false;
+    } else {
+        listaVertices.push_back(vertice);
+        listaAdyacencia.emplace_back();
+        componentes.agregarElemento();
+        nroDeVertice = listaVertices.size() - 1;
+        if (idsEstables) {
+            eliminados.push_back(false);
+            if (esDirigido())
+                listaEntrantes.emplace_back();
+        }
+    }
+    indiceVertices[vertice] = nroDeVertice;
+    observadores.notificar([&](auto &observador) { observador.verticeInsertado(vertice, nroDeVertice); });
+}
+
+template<typename T>
+void GrafoPesado<T>::cargarMasivo(std::vector<T> vertices, std::vector<std::vector<AdyacenteConPeso> > adyacencia) {
+    if (vertices.size() != adyacencia.size())
+        throw std::invalid_argument("La cantidad de listas no coincide con la de vertices");
+    listaVertices = std::move(vertices);
+    listaAdyacencia = std::move(adyacencia);
+    eliminados.assign(idsEstables ? listaVertices.size() : 0, false);
+    posicionesLibres.clear();
+    reconstruirIndices();
+    recalcularComponentes();
+    observadores.notificar([](auto &observador) { observador.grafoReemplazado(); });
+}
+
+template<typename T>
+void GrafoPesado<T>::reconstruirIndices() {
+    indiceVertices.clear();
+    for (int i = 0; i < listaVertices.size(); i++) {
+        if (!estaEliminado(i) && !indiceVertices.emplace(listaVertices[i], i).second)
+            throw std::invalid_argument("El vertice ya existe");
+    }
+
+    if (!idsEstables)
+        return;
+    listaEntrantes.clear();
+    if (esDirigido()) {
+        listaEntrantes.resize(listaVertices.size());
+        for (int i = 0; i < listaAdyacencia.size(); i++)
+            for (const auto &adyacente: listaAdyacencia[i])
+                listaEntrantes[adyacente.indiceVertice].push_back(i);
+    }
+}
+
+template<typename T>
+void GrafoPesado<T>::activarIdsEstables() {
+    if (idsEstables)
+        return;
+    idsEstables = true;
+    eliminados.assign(listaVertices.size(), false);
+    reconstruirIndices();
+}
+
+template<typename T>
+bool GrafoPesado<T>::estaEliminado(int nroVertice) const {
+    return idsEstables && nroVertice >= 0 && nroVertice < eliminados.size() && eliminados[nroVertice];
+}
+
+template<typename T>
+void GrafoPesado<T>::desconectarVertice(int nroVertice) {
+    for (const auto &adyacente: listaAdyacencia[nroVertice]) {
+        // Un lazo apunta a la misma lista que se recorre: se descarta con el clear() final.
+        if (adyacente.indiceVertice == nroVertice)
+            continue;
+        auto &inversos = listaAdyacencia[adyacente.indiceVertice];
+        inversos.erase(std::remove_if(inversos.begin(), inversos.end(),
+                                      [nroVertice](const AdyacenteConPeso &inverso) {
+                                          return inverso.indiceVertice == nroVertice;
+                                      }),
+                       inversos.end());
+    }
+    listaAdyacencia[nroVertice].clear();
+}
+
+template<typename T>
+std::vector<int> GrafoPesado<T>::compactar() {
+    std::vector<int> renumeracion(listaVertices.size());
+    int siguiente = 0;
+    for (int i = 0; i < listaVertices.size(); i++)
+        renumeracion[i] = estaEliminado(i) ? NRO_VERTICE_INVALIDO : siguiente++;
+    if (siguiente == listaVertices.size())
+        return renumeracion;
+
+    for (int i = 0; i < listaVertices.size(); i++) {
+        int nuevo = renumeracion[i];
+        if (nuevo == NRO_VERTICE_INVALIDO)
+            continue;
+        for (auto &adyacente: listaAdyacencia[i])
+            adyacente.indiceVertice = renumeracion[adyacente.indiceVertice];
+        if (nuevo != i) {
+            listaVertices[nuevo] = std::move(listaVertices[i]);
+            listaAdyacencia[nuevo] = std::move(listaAdyacencia[i]);
+        }
+    }
+    listaVertices.resize(siguiente);
+    listaAdyacencia.resize(siguiente);
+    eliminados.assign(siguiente, false);
+    posicionesLibres.clear();
+    reconstruirIndices();
+    recalcularComponentes();
+    observadores.notificar([](auto &observador) { observador.grafoReemplazado(); });
+    return renumeracion;
 }
 
 template<typename T>
 void GrafoPesado<T>::eliminarVertice(const T &vertice) {
     validarVertice(vertice);
     int nroDeVertice = getNroVertice(vertice);
+    componentesVigentes = false;
+
+    if (idsEstables) {
+        desconectarVertice(nroDeVertice);
+        indiceVertices.erase(vertice);
+        listaVertices[nroDeVertice] = T();
+        eliminados[nroDeVertice] = true;
+        posicionesLibres.push_back(nroDeVertice);
+        observadores.notificar([&](auto &observador) { observador.verticeEliminado(vertice, nroDeVertice); });
+        return;
+    }
 
     listaVertices.erase(listaVertices.begin() + nroDeVertice);
     listaAdyacencia.erase(listaAdyacencia.begin() + nroDeVertice);
@@ -44,6 +165,12 @@ void GrafoPesado<T>::eliminarVertice(const T &vertice) {
                 adyacenteConPeso.indiceVertice--;
         }
     }
+    indiceVertices.erase(vertice);
+    for (auto &[nombre, nro]: indiceVertices) {
+        if (nro > nroDeVertice)
+            nro--;
+    }
+    observadores.notificar([&](auto &observador) { observador.verticeEliminado(vertice, nroDeVertice); });
 }
 
 template<typename T>
@@ -61,6 +188,10 @@ void GrafoPesado<T>::insertarArista(const T &origen, const T &destino, double di
         listaAdyacencia[nroDeDestino].emplace_back(nroDeOrigen, distancia, tiempo);
         std::sort(listaAdyacencia[nroDeDestino].begin(), listaAdyacencia[nroDeDestino].end());
     }
+    registrarConexion(nroDeOrigen, nroDeDestino);
+    observadores.notificar([&](auto &observador) {
+        observador.aristaInsertada(nroDeOrigen, nroDeDestino, distancia, tiempo);
+    });
 }
 
 template<typename T>
@@ -89,6 +220,8 @@ void GrafoPesado<T>::eliminarArista(const T &origen, const T &destino) {
                                                            }),
                                             listaAdyacencia[nroDeDestino].end());
     }
+    componentesVigentes = false;
+    observadores.notificar([&](auto &observador) { observador.aristaEliminada(nroDeOrigen, nroDeDestino); });
 }
 
 template<typename T>
@@ -119,16 +252,21 @@ void GrafoPesado<T>::actualizarPesoArista(const T &origen, const T &destino, dou
 
     int nroDeOrigen = getNroVertice(origen);
     int nroDeDestino = getNroVertice(destino);
+    double distanciaAnterior = 0;
+    double tiempoAnterior = 0;
 
     for (auto &adyacente: listaAdyacencia[nroDeOrigen]) {
         if (adyacente.indiceVertice == nroDeDestino) {
+            distanciaAnterior = adyacente.distancia;
+            tiempoAnterior = adyacente.tiempo;
             adyacente.distancia = distancia;
             adyacente.tiempo = tiempo;
             break;
         }
     }
 
-    if (nroDeOrigen != nroDeDestino) {
+    // En un dirigido el arco opuesto es otra arista y conserva su peso.
+    if (!esDirigido() && nroDeOrigen != nroDeDestino) {
         for (auto &adyacente: listaAdyacencia[nroDeDestino]) {
             if (adyacente.indiceVertice == nroDeOrigen) {
                 adyacente.distancia = distancia;
@@ -137,6 +275,55 @@ void GrafoPesado<T>::actualizarPesoArista(const T &origen, const T &destino, dou
             }
         }
     }
+    observadores.notificar([&](auto &observador) {
+        observador.pesoActualizado(nroDeOrigen, nroDeDestino, distanciaAnterior, tiempoAnterior, distancia, tiempo);
+    });
+}
+
+template<typename T>
+void GrafoPesado<T>::setCapacidadArista(const T &origen, const T &destino, uint32_t capacidad) {
+    validarVertice(origen);
+    validarVertice(destino);
+
+    if (!existeAdyacencia(origen, destino))
+        throw std::invalid_argument("La arista no existe");
+
+    int nroDeOrigen = getNroVertice(origen);
+    int nroDeDestino = getNroVertice(destino);
+    uint32_t capacidadAnterior = AdyacenteConPeso::SIN_CAPACIDAD;
+
+    for (auto &adyacente: listaAdyacencia[nroDeOrigen]) {
+        if (adyacente.indiceVertice == nroDeDestino) {
+            capacidadAnterior = adyacente.capacidad;
+            adyacente.capacidad = capacidad;
+            break;
+        }
+    }
+
+    if (!esDirigido() && nroDeOrigen != nroDeDestino) {
+        for (auto &adyacente: listaAdyacencia[nroDeDestino]) {
+            if (adyacente.indiceVertice == nroDeOrigen) {
+                adyacente.capacidad = capacidad;
+                break;
+            }
+        }
+    }
+    observadores.notificar([&](auto &observador) {
+        observador.capacidadActualizada(nroDeOrigen, nroDeDestino, capacidadAnterior, capacidad);
+    });
+}
+
+template<typename T>
+uint32_t GrafoPesado<T>::getCapacidadArista(const T &origen, const T &destino) const {
+    validarVertice(origen);
+    validarVertice(destino);
+
+    int nroDeDestino = getNroVertice(destino);
+    for (const auto &adyacente: listaAdyacencia[getNroVertice(origen)]) {
+        if (adyacente.indiceVertice == nroDeDestino)
+            return adyacente.capacidad;
+    }
+    throw std::invalid_argument("La arista no existe");
 }
 
 
@@ -170,9 +357,9 @@ void GrafoPesado<T>::validarVertice(const T &vertice) const {
 
 template<typename T>
 int GrafoPesado<T>::getNroVertice(const T &vertice) const {
-    auto it = std::find(listaVertices.begin(), listaVertices.end(), vertice);
-    if (it != listaVertices.end())
-        return std::distance(listaVertices.begin(), it);
+    auto it = indiceVertices.find(vertice);
+    if (it != indiceVertices.end())
+        return it->second;
     return NRO_VERTICE_INVALIDO;
 }
 
@@ -182,6 +369,18 @@ const std::vector<T> &GrafoPesado<T>::getVertices() const {
 }
 
 
+template<typename T>
+std::vector<T> GrafoPesado<T>::getVerticesActivos() const {
+    if (posicionesLibres.empty())
+        return listaVertices;
+    std::vector<T> activos;
+    activos.reserve(cantidadVerticesActivos());
+    for (int i = 0; i < listaVertices.size(); i++)
+        if (!estaEliminado(i))
+            activos.push_back(listaVertices[i]);
+    return activos;
+}
+
 template<typename T>
 T GrafoPesado<T>::getVertice(int pos) const {
     if (pos < 0 || pos >= listaVertices.size())
@@ -194,6 +393,11 @@ int GrafoPesado<T>::cantidadVertices() const {
     return listaVertices.size();
 }
 
+template<typename T>
+int GrafoPesado<T>::cantidadVerticesActivos() const {
+    return listaVertices.size() - posicionesLibres.size();
+}
+
 template<typename T>
 int GrafoPesado<T>::cantidadAristas() const {
     int cantidadAristas = 0;
@@ -213,9 +417,47 @@ double GrafoPesado<T>::pesoTotal() const {
     return total;
 }
 
+template<typename T>
+void GrafoPesado<T>::registrarConexion(int nroOrigen, int nroDestino) {
+    if (componentesVigentes)
+        componentes.unir(nroOrigen, nroDestino);
+}
+
+template<typename T>
+void GrafoPesado<T>::recalcularComponentes() const {
+    componentes.reiniciar(listaVertices.size());
+    for (int i = 0; i < listaAdyacencia.size(); i++)
+        for (const auto &adyacente: listaAdyacencia[i])
+            componentes.unir(i, adyacente.indiceVertice);
+    componentesVigentes = true;
+}
+
+template<typename T>
+void GrafoPesado<T>::asegurarComponentes() const {
+    if (componentesVigentes)
+        return;
+    std::lock_guard<std::mutex> cerrojo(componentesVigentes.getMutex());
+    // Otro hilo pudo reconstruirlas mientras se esperaba el cerrojo.
+    if (!componentesVigentes)
+        recalcularComponentes();
+}
+
+template<typename T>
+int GrafoPesado<T>::cantidadComponentes() {
+    asegurarComponentes();
+    // Las lápidas no tienen aristas: cada una quedó como un conjunto unitario.
+    return componentes.getCantidadConjuntos() - posicionesLibres.size();
+}
+
+template<typename T>
+bool GrafoPesado<T>::sonInalcanzables(int nroOrigen, int nroDestino) const {
+    asegurarComponentes();
+    return !componentes.mismoConjunto(nroOrigen, nroDestino);
+}
+
 template<typename T>
 bool GrafoPesado<T>::esConexo() {
-    return false;
+    return cantidadComponentes() <= 1;
 }
 
 template<typename T>
@@ -241,14 +483,20 @@ std::string GrafoPesado<T>::toString() const {
 
 template<typename T>
 std::vector<T> GrafoPesado<T>::obtenerCaminoDijkstra(const T &origen, const T &destino) const {
-    auto resultado = dijkstraConCamino(origen, destino);
-    return resultado.camino;
+    return obtenerCaminoTradicional(origen, destino);
 }
 
 template<typename T>
 double GrafoPesado<T>::obtenerTiempoDijkstra(const T &origen, const T &destino) const {
-    auto resultado = dijkstraConCamino(origen, destino);
-    return resultado.tiempoTotal;
+    // Tiempo total del camino de menor distancia
+    std::vector<T> camino = obtenerCaminoTradicional(origen, destino);
+    if (camino.empty())
+        return -1;
+
+    double tiempoTotal = 0;
+    for (int i = 0; i + 1 < camino.size(); i++)
+        tiempoTotal += getTiempoArista(camino[i], camino[i + 1]);
+    return tiempoTotal;
 }
 
 
@@ -289,126 +537,63 @@ std::vector<AdyacenteConPeso> GrafoPesado<T>::getAdyacentesDelVerticeConPeso(con
 }
 
 template<typename T>
-std::vector<double> GrafoPesado<T>::dijkstra(const T &origen) const {
-    validarVertice(origen);
-
-    int n = cantidadVertices();
-    int indiceOrigen = getNroVertice(origen);
-
-    std::vector costos(n, 1e10);
-    std::vector predecesores(n, -1);
-    Marcado marcados(n);
-
-    costos[indiceOrigen] = 0;
-
-    // Algoritmo principal
-    for (int i = 0; i < n; i++) {
-        // Encontrar vértice no marcado con menor costo
-        int verticeActual = -1;
-        double menorCosto = 1e10;
-
-        for (int j = 0; j < n; j++) {
-            if (!marcados.estaMarcado(j) && costos[j] < menorCosto) {
-                menorCosto = costos[j];
-                verticeActual = j;
-            }
-        }
-
-        // Si no encontramos vértice válido, terminamos
-        if (verticeActual == -1) break;
-
-        // Marcar el vértice actual
-        marcados.marcar(verticeActual);
-
-        // Actualizar costos de los adyacentes
-        for (const auto &adyacente : listaAdyacencia[verticeActual]) {
-            int vecino = adyacente.indiceVertice;
-            double peso = adyacente.distancia;
-
-            if (!marcados.estaMarcado(vecino)) {
-                double nuevoCosto = costos[verticeActual] + peso;
-                if (nuevoCosto < costos[vecino]) {
-                    costos[vecino] = nuevoCosto;
-                    predecesores[vecino] = verticeActual;
-                }
-            }
-        }
-    }
+std::span<const AdyacenteConPeso> GrafoPesado<T>::adyacentesDe(int nroVertice) const {
+    if (nroVertice < 0 || nroVertice >= listaAdyacencia.size())
+        throw std::out_of_range("Posición invalida");
+    return listaAdyacencia[nroVertice];
+}
 
-    return costos;
+template<typename T>
+template<typename Filtro>
+std::vector<double> GrafoPesado<T>::dijkstra(const T &origen, const Filtro &filtro) const {
+    EspacioConsulta &espacio = EspacioConsulta::delHilo();
+    dijkstra(origen, espacio, filtro);
+    return espacio.costosCompletos(cantidadVertices());
 }
 
+template<typename T>
+template<typename Filtro>
+void GrafoPesado<T>::dijkstra(const T &origen, EspacioConsulta &espacio, const Filtro &filtro) const {
+    validarVertice(origen);
+    buscarCaminos(*this, getNroVertice(origen), espacio, PesoDistancia(), SinParada(), VisitanteNulo(), filtro);
+}
 
 template<typename T>
-std::vector<T> GrafoPesado<T>::obtenerCaminoTradicional(const T &origen, const T &destino) const {
+template<typename Filtro>
+std::vector<T> GrafoPesado<T>::obtenerCaminoTradicional(const T &origen, const T &destino,
+                                                        const Filtro &filtro) const {
     validarVertice(origen);
     validarVertice(destino);
 
-    int n = cantidadVertices();
-    int indiceOrigen = getNroVertice(origen);
     int indiceDestino = getNroVertice(destino);
-
-    // Inicializar estructuras
-    std::vector costos(n, 1e10);
-    std::vector predecesores(n, -1);
-    Marcado marcados(n);
-
-    costos[indiceOrigen] = 0;
-
-    for (int i = 0; i < n; i++) {
-        int verticeActual = -1;
-        double menorCosto = 1e10;
-
-        for (int j = 0; j < n; j++) {
-            if (!marcados.estaMarcado(j) && costos[j] < menorCosto) {
-                menorCosto = costos[j];
-                verticeActual = j;
-            }
-        }
-
-        if (verticeActual == -1) break;
-        marcados.marcar(verticeActual);
-
-        for (const auto &adyacente : listaAdyacencia[verticeActual]) {
-            int vecino = adyacente.indiceVertice;
-            double peso = adyacente.distancia;
-
-            if (!marcados.estaMarcado(vecino)) {
-                double nuevoCosto = costos[verticeActual] + peso;
-                if (nuevoCosto < costos[vecino]) {
-                    costos[vecino] = nuevoCosto;
-                    predecesores[vecino] = verticeActual;
-                }
-            }
-        }
-    }
-
+    if (sonInalcanzables(getNroVertice(origen), indiceDestino))
+        return {};
+    EspacioConsulta &espacio = EspacioConsulta::delHilo();
+    buscarCaminos(*this, getNroVertice(origen), espacio, PesoDistancia(), ParadaEnDestino(indiceDestino),
+                  VisitanteNulo(), filtro);
 
     std::vector<T> camino;
-    if (costos[indiceDestino] >= 1e10) {
-        return camino;
-    }
-
-    int actual = indiceDestino;
-    while (actual != -1) {
-        camino.push_back(listaVertices[actual]);
-        actual = predecesores[actual];
-    }
-
-    std::reverse(camino.begin(), camino.end());
+    for (int indice: espacio.reconstruirCamino(indiceDestino))
+        camino.push_back(listaVertices[indice]);
     return camino;
 }
 
 
 template<typename T>
-double GrafoPesado<T>::obtenerCostoMinimo(const T &origen, const T &destino) const {
+template<typename Filtro>
+double GrafoPesado<T>::obtenerCostoMinimo(const T &origen, const T &destino, const Filtro &filtro) const {
     validarVertice(origen);
     validarVertice(destino);
 
-    std::vector<double> costos = dijkstra(origen);
     int indiceDestino = getNroVertice(destino);
-
-    return costos[indiceDestino] >= 1e10 ? -1 : costos[indiceDestino];
+    if (sonInalcanzables(getNroVertice(origen), indiceDestino))
+        return -1;
+    EspacioConsulta &espacio = EspacioConsulta::delHilo();
+    buscarCaminos(*this, getNroVertice(origen), espacio, PesoDistancia(), ParadaEnDestino(indiceDestino),
+                  VisitanteNulo(), filtro);
+
+    double costo = espacio.getCosto(indiceDestino);
+    return costo >= EspacioConsulta::INFINITO ? -1 : costo;
 }
 
 
@@ -419,12 +604,6 @@ void GrafoPesado<T>::mostrarProcesoDijkstra(const T &origen) const {
     int n = cantidadVertices();
     int indiceOrigen = getNroVertice(origen);
 
-    std::vector costos(n, 1e10);
-    std::vector predecesores(n, -1);
-    Marcado marcados(n);
-
-    costos[indiceOrigen] = 0;
-
     std::cout << "Estado inicial:" << std::endl;
     std::cout << "Vértices: ";
     for (int i = 0; i < n; i++) {
@@ -434,111 +613,31 @@ void GrafoPesado<T>::mostrarProcesoDijkstra(const T &origen) const {
 
     std::cout << "Costos: ";
     for (int i = 0; i < n; i++) {
-        if (costos[i] >= 1e10) {
-            std::cout << "∞ ";
-        } else {
-            std::cout << costos[i] << " ";
-        }
+        std::cout << (i == indiceOrigen ? "0 " : "∞ ");
     }
     std::cout << std::endl << std::endl;
 
-    for (int iteracion = 0; iteracion < n; iteracion++) {
-        // Encontrar vértice no marcado con menor costo
-        int verticeActual = -1;
-        double menorCosto = 1e10;
-
-        for (int j = 0; j < n; j++) {
-            if (!marcados.estaMarcado(j) && costos[j] < menorCosto) {
-                menorCosto = costos[j];
-                verticeActual = j;
-            }
-        }
-
-        if (verticeActual == -1) break;
-
-        std::cout << "Iteración " << iteracion + 1 << ":" << std::endl;
-        std::cout << "Vértice seleccionado: " << verticeActual << " (costo: " << costos[verticeActual] << ")" << std::endl;
-
-        marcados.marcar(verticeActual);
-
-        // Actualizar costos de adyacentes
-        for (const auto &adyacente : listaAdyacencia[verticeActual]) {
-            int vecino = adyacente.indiceVertice;
-            double peso = adyacente.distancia;
-
-            if (!marcados.estaMarcado(vecino)) {
-                double nuevoCosto = costos[verticeActual] + peso;
-                if (nuevoCosto < costos[vecino]) {
-                    std::cout << "  Actualizando vértice " << vecino << ": " << costos[vecino] << " -> " << nuevoCosto << std::endl;
-                    costos[vecino] = nuevoCosto;
-                    predecesores[vecino] = verticeActual;
-                }
-            }
-        }
-
-        std::cout << "Costos actuales: ";
-        for (int i = 0; i < n; i++) {
-            if (costos[i] >= 1e10) {
-                std::cout << "∞ ";
-            } else {
-                std::cout << costos[i] << " ";
-            }
-        }
-        std::cout << std::endl;
-
-        std::cout << "Marcados: ";
-        for (int i = 0; i < n; i++) {
-            std::cout << (marcados.estaMarcado(i) ? "✓" : "✗") << " ";
-        }
-        std::cout << std::endl << std::endl;
-    }
+    EspacioConsulta espacio;
+    TrazaDijkstra traza(std::cout, espacio, n);
+    buscarCaminos(*this, indiceOrigen, espacio, PesoDistancia(), SinParada(), traza);
 }
 
 
 template<typename T>
-double GrafoPesado<T>::obtenerTiempoTradicional(const T &origen, const T &destino) const {
+template<typename Filtro>
+double GrafoPesado<T>::obtenerTiempoTradicional(const T &origen, const T &destino,
+                                                const Filtro &filtro) const {
     validarVertice(origen);
     validarVertice(destino);
 
-    int n = cantidadVertices();
-    int indiceOrigen = getNroVertice(origen);
+    // Misma búsqueda, usando el tiempo como peso
     int indiceDestino = getNroVertice(destino);
-
-    // Inicializar estructuras
-    std::vector tiempos(n, 1e10);  // Array de tiempos en lugar de distancias
-    std::vector predecesores(n, -1);
-    Marcado marcados(n);
-
-    tiempos[indiceOrigen] = 0;
-
-    // Ejecutar algoritmo usando tiempo como peso
-    for (int i = 0; i < n; i++) {
-        int verticeActual = -1;
-        double menorTiempo = 1e10;
-
-        for (int j = 0; j < n; j++) {
-            if (!marcados.estaMarcado(j) && tiempos[j] < menorTiempo) {
-                menorTiempo = tiempos[j];
-                verticeActual = j;
-            }
-        }
-
-        if (verticeActual == -1) break;
-        marcados.marcar(verticeActual);
-
-        for (const auto &adyacente : listaAdyacencia[verticeActual]) {
-            int vecino = adyacente.indiceVertice;
-            double peso = adyacente.tiempo;  // Usar tiempo en lugar de distancia
-
-            if (!marcados.estaMarcado(vecino)) {
-                double nuevoTiempo = tiempos[verticeActual] + peso;
-                if (nuevoTiempo < tiempos[vecino]) {
-                    tiempos[vecino] = nuevoTiempo;
-                    predecesores[vecino] = verticeActual;
-                }
-            }
-        }
-    }
-
-    return tiempos[indiceDestino] >= 1e10 ? -1 : tiempos[indiceDestino];
+    if (sonInalcanzables(getNroVertice(origen), indiceDestino))
+        return -1;
+    EspacioConsulta &espacio = EspacioConsulta::delHilo();
+    buscarCaminos(*this, getNroVertice(origen), espacio, PesoTiempo(), ParadaEnDestino(indiceDestino),
+                  VisitanteNulo(), filtro);
+
+    double tiempo = espacio.getCosto(indiceDestino);
+    return tiempo >= EspacioConsulta::INFINITO ? -1 : tiempo;
 }
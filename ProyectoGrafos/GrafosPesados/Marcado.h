@@ -4,6 +4,8 @@
 
 #ifndef MARCADO_H
 #define MARCADO_H
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 
@@ -39,4 +41,47 @@ public:
     }
 };
 
+// Variante de Marcado sellada con un contador de generación: reiniciar() es O(1)
+// porque sólo avanza la época; un vértice está marcado si su sello es la época actual.
+class MarcadoEpoca {
+private:
+    std::vector<uint32_t> sellos;
+    uint32_t epoca;
+
+public:
+    explicit MarcadoEpoca(int cantidadVertices = 0) : sellos(cantidadVertices, 0), epoca(1) {
+    }
+
+    void redimensionar(int cantidadVertices) {
+        if (cantidadVertices > sellos.size())
+            sellos.resize(cantidadVertices, 0);
+    }
+
+    void marcar(int vertice) {
+        if (vertice >= 0 && vertice < sellos.size()) {
+            sellos[vertice] = epoca;
+        }
+    }
+
+    bool estaMarcado(int vertice) const {
+        if (vertice >= 0 && vertice < sellos.size()) {
+            return sellos[vertice] == epoca;
+        }
+        return false;
+    }
+
+    void desmarcar(int vertice) {
+        if (vertice >= 0 && vertice < sellos.size()) {
+            sellos[vertice] = 0;
+        }
+    }
+
+    void reiniciar() {
+        if (++epoca == 0) {
+            std::fill(sellos.begin(), sellos.end(), 0);
+            epoca = 1;
+        }
+    }
+};
+
 #endif //MARCADO_H
@@ -0,0 +1,71 @@
+#ifndef OBSERVADORGRAFO_H
+#define OBSERVADORGRAFO_H
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Recibe las mutaciones de un GrafoPesado después de que se aplicaron con éxito.
+// Los números de vértice corresponden al estado del grafo tras la mutación.
+template<typename T>
+class ObservadorGrafo {
+public:
+    virtual ~ObservadorGrafo() = default;
+
+    virtual void verticeInsertado(const T &vertice, int nroVertice) {
+    }
+
+    virtual void verticeEliminado(const T &vertice, int nroVertice) {
+    }
+
+    virtual void aristaInsertada(int nroOrigen, int nroDestino, double distancia, double tiempo) {
+    }
+
+    virtual void aristaEliminada(int nroOrigen, int nroDestino) {
+    }
+
+    virtual void pesoActualizado(int nroOrigen, int nroDestino, double distanciaAnterior, double tiempoAnterior,
+                                 double distancia, double tiempo) {
+    }
+
+    virtual void capacidadActualizada(int nroOrigen, int nroDestino, uint32_t capacidadAnterior, uint32_t capacidad) {
+    }
+
+    // El contenido completo se reemplazó (carga masiva o renumeración).
+    virtual void grafoReemplazado() {
+    }
+};
+
+// Lista de observadores que no se copia junto con el grafo: una copia (p. ej. la que
+// guarda FloydWarshall) no debe notificar a los observadores del original.
+template<typename T>
+class ListaObservadores {
+private:
+    std::vector<ObservadorGrafo<T> *> observadores;
+
+public:
+    ListaObservadores() = default;
+
+    ListaObservadores(const ListaObservadores &) {
+    }
+
+    ListaObservadores &operator=(const ListaObservadores &) {
+        return *this;
+    }
+
+    void agregar(ObservadorGrafo<T> *observador) {
+        if (std::find(observadores.begin(), observadores.end(), observador) == observadores.end())
+            observadores.push_back(observador);
+    }
+
+    void quitar(ObservadorGrafo<T> *observador) {
+        observadores.erase(std::remove(observadores.begin(), observadores.end(), observador), observadores.end());
+    }
+
+    template<typename Notificacion>
+    void notificar(Notificacion &&notificacion) const {
+        for (auto *observador: observadores)
+            notificacion(*observador);
+    }
+};
+
+#endif //OBSERVADORGRAFO_H
@@ -0,0 +1,56 @@
+#ifndef AESTRELLA_H
+#define AESTRELLA_H
+#include <vector>
+
+#include "IndiceEspacial.h"
+#include "../BusquedaCaminos.h"
+
+struct ResultadoAEstrella {
+    std::vector<int> camino;
+    // EspacioConsulta::INFINITO si no hay camino.
+    double costo = EspacioConsulta::INFINITO;
+    int expandidos = 0;
+
+    bool existeCamino() const { return !camino.empty(); }
+};
+
+// A* guiado por la distancia de gran círculo al destino por 'costoPorKilometro'. Es
+// exacto mientras esa cota no supere el costo real que falta: con distancias de ruta en
+// km nunca menores que la geodésica basta costoPorKilometro = 1; para tiempos, 1 sobre
+// la velocidad máxima (costoPorKilometroAdmisible lo calcula a partir de las aristas).
+// Los vértices sin coordenada usan cota 0, pero un camino que pasa por ellos puede
+// costar menos que la cota de sus vecinos: sólo es exacto si también esos caminos
+// cuestan al menos costoPorKilometro por la geodésica. Como un vértice que mejora
+// después de expandirse se vuelve a expandir, la cota no necesita ser consistente; por
+// lo mismo sólo las mejoras estrictas cambian un predecesor, o los empates sobre
+// aristas de costo 0 podrían cerrar un ciclo de predecesores entre vértices ya expandidos.
+template<typename Grafo, typename Politica = PesoDistancia>
+ResultadoAEstrella buscarAEstrella(const Grafo &grafo, int origen, int destino,
+                                   const std::vector<Coordenada> &coordenadas, double costoPorKilometro = 1,
+                                   Politica peso = Politica(),
+                                   EspacioConsulta &espacio = EspacioConsulta::delHilo());
+
+// Mayor costoPorKilometro que mantiene exacto a A*: el mínimo de peso(arista) sobre la
+// distancia geodésica entre sus extremos separados. Por la desigualdad triangular ningún
+// camino cuesta menos que ese factor por la geodésica, pero sólo si todos sus vértices
+// están ubicados: si alguna arista toca un vértice sin coordenada, o no hay aristas que
+// medir, devuelve 0 (Dijkstra).
+template<typename T, typename Politica = PesoDistancia>
+double costoPorKilometroAdmisible(const IndiceEspacial<T> &indice, Politica peso = Politica());
+
+struct ResultadoRutaPuntos {
+    // Vértices donde se ajustaron los puntos y a qué distancia quedaron.
+    VecinoCercano desde;
+    VecinoCercano hasta;
+    ResultadoAEstrella ruta;
+};
+
+// Ajusta cada punto al vértice más cercano que tenga rutas (entre los 'candidatos' más
+// cercanos; si ninguno tiene, al más cercano) y los une con A*.
+template<typename T, typename Politica = PesoDistancia>
+ResultadoRutaPuntos rutaEntrePuntos(const IndiceEspacial<T> &indice, const Coordenada &desde,
+                                    const Coordenada &hasta, double costoPorKilometro = 1,
+                                    Politica peso = Politica(), int candidatos = 8);
+
+#endif //AESTRELLA_H
+#include "AEstrella.tpp"
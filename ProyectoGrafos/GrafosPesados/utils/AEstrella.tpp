@@ -0,0 +1,90 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+template<typename Grafo, typename Politica>
+ResultadoAEstrella buscarAEstrella(const Grafo &grafo, int origen, int destino,
+                                   const std::vector<Coordenada> &coordenadas, double costoPorKilometro,
+                                   Politica peso, EspacioConsulta &espacio) {
+    const int n = grafo.cantidadVertices();
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n)
+        throw std::invalid_argument("Vertice invalido");
+    if (costoPorKilometro < 0)
+        throw std::invalid_argument("El costo por kilometro no puede ser negativo");
+
+    const Coordenada meta = destino < static_cast<int>(coordenadas.size()) ? coordenadas[destino] : Coordenada();
+    auto cota = [&](int vertice) {
+        if (!meta.esValida() || vertice >= static_cast<int>(coordenadas.size()) || !coordenadas[vertice].esValida())
+            return 0.0;
+        return distanciaKilometros(coordenadas[vertice], meta) * costoPorKilometro;
+    };
+
+    ResultadoAEstrella resultado;
+    espacio.preparar(n);
+    espacio.relajar(origen, 0, EspacioConsulta::SIN_PREDECESOR);
+    espacio.insertarEnMonticulo(cota(origen), origen);
+    while (!espacio.monticuloVacio()) {
+        auto [prioridad, vertice] = espacio.extraerMinimo();
+        // Entrada obsoleta: el vértice mejoró después de encolarse.
+        double costo = espacio.getCosto(vertice);
+        if (prioridad > costo + cota(vertice)) continue;
+        if (vertice == destino) {
+            resultado.costo = costo;
+            resultado.camino = espacio.reconstruirCamino(destino);
+            break;
+        }
+        resultado.expandidos++;
+        for (const auto &adyacente: grafo.adyacentesDe(vertice)) {
+            int vecino = adyacente.indiceVertice;
+            double nuevoCosto = costo + peso(adyacente);
+            if (nuevoCosto < espacio.getCosto(vecino) && espacio.relajar(vecino, nuevoCosto, vertice))
+                espacio.insertarEnMonticulo(nuevoCosto + cota(vecino), vecino);
+        }
+    }
+    return resultado;
+}
+
+template<typename T, typename Politica>
+double costoPorKilometroAdmisible(const IndiceEspacial<T> &indice, Politica peso) {
+    const GrafoPesado<T> &grafo = indice.getGrafo();
+    const std::vector<Coordenada> &coordenadas = indice.getCoordenadas();
+    const int ubicados = std::min<int>(grafo.cantidadVertices(), coordenadas.size());
+    auto ubicado = [&](int v) { return v < ubicados && coordenadas[v].esValida(); };
+    double minimo = std::numeric_limits<double>::infinity();
+    for (int v = 0; v < grafo.cantidadVertices(); v++) {
+        for (const auto &adyacente: grafo.adyacentesDe(v)) {
+            int w = adyacente.indiceVertice;
+            // Un desvío por un vértice sin coordenada no está acotado por la geodésica.
+            if (!ubicado(v) || !ubicado(w))
+                return 0;
+            double kilometros = distanciaKilometros(coordenadas[v], coordenadas[w]);
+            if (kilometros > 0)
+                minimo = std::min(minimo, peso(adyacente) / kilometros);
+        }
+    }
+    return std::isinf(minimo) ? 0 : minimo;
+}
+
+template<typename T, typename Politica>
+ResultadoRutaPuntos rutaEntrePuntos(const IndiceEspacial<T> &indice, const Coordenada &desde,
+                                    const Coordenada &hasta, double costoPorKilometro, Politica peso,
+                                    int candidatos) {
+    const GrafoPesado<T> &grafo = indice.getGrafo();
+    auto ajustar = [&](const Coordenada &punto) {
+        std::vector<VecinoCercano> cercanos = indice.masCercanos(punto, std::max(1, candidatos));
+        if (cercanos.empty())
+            throw std::invalid_argument("No hay vertices con coordenadas");
+        for (const auto &cercano: cercanos)
+            if (!grafo.adyacentesDe(cercano.vertice).empty()) return cercano;
+        return cercanos.front();
+    };
+
+    ResultadoRutaPuntos resultado;
+    resultado.desde = ajustar(desde);
+    resultado.hasta = ajustar(hasta);
+    resultado.ruta = buscarAEstrella(grafo, resultado.desde.vertice, resultado.hasta.vertice,
+                                     indice.getCoordenadas(), costoPorKilometro, peso);
+    return resultado;
+}
@@ -0,0 +1,89 @@
+#ifndef ARBOLCAMINOSDINAMICO_H
+#define ARBOLCAMINOSDINAMICO_H
+#include <utility>
+#include <vector>
+
+#include "../BusquedaCaminos.h"
+#include "../GrafoPesado.h"
+
+struct EstadisticasReparacion {
+    // Vértices cuyo costo o predecesor se revisó en la última actualización.
+    int verticesTocados = 0;
+    bool recalculoCompleto = false;
+};
+
+// Árbol de caminos mínimos desde un origen que se mantiene al día con las mutaciones
+// del grafo (al estilo de Ramalingam y Reps). Si un arco mejora, se propaga sólo a
+// los vértices que mejoran; si empeora o desaparece un arco del árbol, se invalida el
+// subárbol que colgaba de él y se repara desde sus vecinos no afectados. Insertar o
+// eliminar vértices y las cargas masivas recalculan todo.
+template<typename T, typename Politica = PesoDistancia>
+class ArbolCaminosDinamico : public ObservadorGrafo<T> {
+    using EntradaMonticulo = std::pair<double, int>;
+
+private:
+    GrafoPesado<T> &grafo;
+    T verticeOrigen;
+    int origen;
+    Politica peso;
+
+    std::vector<double> costos;
+    std::vector<int> predecesores;
+    std::vector<std::vector<int> > hijos;
+    // Orígenes de los arcos que llegan a cada vértice (sólo en grafos dirigidos).
+    std::vector<std::vector<int> > entrantes;
+    std::vector<EntradaMonticulo> monticulo;
+    MarcadoEpoca afectados;
+    EstadisticasReparacion ultimaReparacion;
+
+    double pesoMinimo(int desde, int hasta) const;
+
+    void asignarPredecesor(int vertice, int predecesor);
+
+    bool ofrecer(int vertice, double costo, int predecesor);
+
+    void propagarMejoras();
+
+    void repararSubarbol(int raiz);
+
+    void revisarArco(int desde, int hasta);
+
+    void revisarCambio(int nroOrigen, int nroDestino);
+
+public:
+    ArbolCaminosDinamico(GrafoPesado<T> &grafo, const T &origen, Politica peso = Politica());
+
+    ~ArbolCaminosDinamico() override;
+
+    ArbolCaminosDinamico(const ArbolCaminosDinamico &) = delete;
+
+    ArbolCaminosDinamico &operator=(const ArbolCaminosDinamico &) = delete;
+
+    void recalcular();
+
+    double getCosto(int nroVertice) const { return costos[nroVertice]; }
+
+    int getPredecesor(int nroVertice) const { return predecesores[nroVertice]; }
+
+    const std::vector<double> &getCostos() const { return costos; }
+
+    std::vector<int> caminoHasta(int nroVertice) const;
+
+    const EstadisticasReparacion &getUltimaReparacion() const { return ultimaReparacion; }
+
+    void verticeInsertado(const T &vertice, int nroVertice) override;
+
+    void verticeEliminado(const T &vertice, int nroVertice) override;
+
+    void aristaInsertada(int nroOrigen, int nroDestino, double distancia, double tiempo) override;
+
+    void aristaEliminada(int nroOrigen, int nroDestino) override;
+
+    void pesoActualizado(int nroOrigen, int nroDestino, double distanciaAnterior, double tiempoAnterior,
+                         double distancia, double tiempo) override;
+
+    void grafoReemplazado() override;
+};
+
+#endif //ARBOLCAMINOSDINAMICO_H
+#include "ArbolCaminosDinamico.tpp"
@@ -0,0 +1,224 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+
+template<typename T, typename Politica>
+ArbolCaminosDinamico<T, Politica>::ArbolCaminosDinamico(GrafoPesado<T> &grafo, const T &origen, Politica peso)
+    : grafo(grafo), verticeOrigen(origen), origen(-1), peso(peso) {
+    grafo.validarVertice(origen);
+    recalcular();
+    grafo.agregarObservador(this);
+}
+
+template<typename T, typename Politica>
+ArbolCaminosDinamico<T, Politica>::~ArbolCaminosDinamico() {
+    grafo.quitarObservador(this);
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::recalcular() {
+    int n = grafo.cantidadVertices();
+    costos.assign(n, EspacioConsulta::INFINITO);
+    predecesores.assign(n, EspacioConsulta::SIN_PREDECESOR);
+    hijos.assign(n, std::vector<int>());
+    afectados = MarcadoEpoca(n);
+
+    entrantes.assign(grafo.esDirigido() ? n : 0, std::vector<int>());
+    for (int u = 0; u < entrantes.size(); u++) {
+        for (const auto &arco: grafo.adyacentesDe(u)) {
+            auto &lista = entrantes[arco.indiceVertice];
+            if (std::find(lista.begin(), lista.end(), u) == lista.end())
+                lista.push_back(u);
+        }
+    }
+
+    ultimaReparacion = EstadisticasReparacion();
+    ultimaReparacion.recalculoCompleto = true;
+    origen = grafo.getNroVertice(verticeOrigen);
+    if (origen == GrafoPesado<T>::NRO_VERTICE_INVALIDO)
+        return;
+
+    EspacioConsulta espacio;
+    buscarCaminos(grafo, origen, espacio, peso);
+    for (int v: espacio.getTocados()) {
+        costos[v] = espacio.getCosto(v);
+        asignarPredecesor(v, espacio.getPredecesor(v));
+    }
+    ultimaReparacion.verticesTocados = espacio.getTocados().size();
+}
+
+template<typename T, typename Politica>
+double ArbolCaminosDinamico<T, Politica>::pesoMinimo(int desde, int hasta) const {
+    // Entre arcos paralelos cuenta el más barato.
+    double minimo = EspacioConsulta::INFINITO;
+    for (const auto &arco: grafo.adyacentesDe(desde)) {
+        if (arco.indiceVertice == hasta)
+            minimo = std::min(minimo, peso(arco));
+    }
+    return minimo;
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::asignarPredecesor(int vertice, int predecesor) {
+    int anterior = predecesores[vertice];
+    if (anterior == predecesor)
+        return;
+    if (anterior != EspacioConsulta::SIN_PREDECESOR) {
+        auto &lista = hijos[anterior];
+        lista.erase(std::find(lista.begin(), lista.end(), vertice));
+    }
+    if (predecesor != EspacioConsulta::SIN_PREDECESOR)
+        hijos[predecesor].push_back(vertice);
+    predecesores[vertice] = predecesor;
+}
+
+template<typename T, typename Politica>
+bool ArbolCaminosDinamico<T, Politica>::ofrecer(int vertice, double costo, int predecesor) {
+    // Sólo una mejora estricta cambia el predecesor: aceptar empates podría colgar un
+    // vértice de su propio subárbol a través de aristas de peso 0 y cerrar un ciclo.
+    if (costo < costos[vertice]) {
+        costos[vertice] = costo;
+        asignarPredecesor(vertice, predecesor);
+        monticulo.emplace_back(costo, vertice);
+        std::push_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+        return true;
+    }
+    return false;
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::propagarMejoras() {
+    while (!monticulo.empty()) {
+        std::pop_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+        auto [costo, vertice] = monticulo.back();
+        monticulo.pop_back();
+        if (costo > costos[vertice]) continue;
+        ultimaReparacion.verticesTocados++;
+        for (const auto &arco: grafo.adyacentesDe(vertice))
+            ofrecer(arco.indiceVertice, costo + peso(arco), vertice);
+    }
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::repararSubarbol(int raiz) {
+    // Invalida el subárbol que cuelga de 'raiz'.
+    afectados.reiniciar();
+    std::vector<int> subarbol{raiz};
+    afectados.marcar(raiz);
+    for (size_t i = 0; i < subarbol.size(); i++) {
+        for (int hijo: hijos[subarbol[i]]) {
+            if (!afectados.estaMarcado(hijo)) {
+                afectados.marcar(hijo);
+                subarbol.push_back(hijo);
+            }
+        }
+    }
+    for (int v: subarbol) {
+        costos[v] = EspacioConsulta::INFINITO;
+        asignarPredecesor(v, EspacioConsulta::SIN_PREDECESOR);
+    }
+
+    // Cada vértice afectado toma el mejor arco desde un vecino no afectado...
+    for (int v: subarbol) {
+        if (grafo.esDirigido()) {
+            for (int u: entrantes[v]) {
+                if (!afectados.estaMarcado(u) && costos[u] < EspacioConsulta::INFINITO)
+                    ofrecer(v, costos[u] + pesoMinimo(u, v), u);
+            }
+        } else {
+            // Sin dirección, el arco v -> u pesa lo mismo que u -> v.
+            for (const auto &arco: grafo.adyacentesDe(v)) {
+                int u = arco.indiceVertice;
+                if (!afectados.estaMarcado(u) && costos[u] < EspacioConsulta::INFINITO)
+                    ofrecer(v, costos[u] + peso(arco), u);
+            }
+        }
+    }
+    ultimaReparacion.verticesTocados += subarbol.size();
+    // ...y el resto se resuelve con Dijkstra dentro del subárbol.
+    propagarMejoras();
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::revisarArco(int desde, int hasta) {
+    if (origen < 0 || desde == hasta)
+        return;
+    double nuevoCosto = costos[desde] + pesoMinimo(desde, hasta);
+    if (ofrecer(hasta, nuevoCosto, desde)) {
+        propagarMejoras();
+    } else if (predecesores[hasta] == desde && nuevoCosto > costos[hasta]) {
+        repararSubarbol(hasta);
+    }
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::revisarCambio(int nroOrigen, int nroDestino) {
+    ultimaReparacion = EstadisticasReparacion();
+    revisarArco(nroOrigen, nroDestino);
+    if (!grafo.esDirigido())
+        revisarArco(nroDestino, nroOrigen);
+}
+
+template<typename T, typename Politica>
+std::vector<int> ArbolCaminosDinamico<T, Politica>::caminoHasta(int nroVertice) const {
+    std::vector<int> camino;
+    if (nroVertice < 0 || nroVertice >= costos.size() || costos[nroVertice] >= EspacioConsulta::INFINITO)
+        return camino;
+    for (int actual = nroVertice; actual != EspacioConsulta::SIN_PREDECESOR; actual = predecesores[actual])
+        camino.push_back(actual);
+    std::reverse(camino.begin(), camino.end());
+    return camino;
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::verticeInsertado(const T &vertice, int nroVertice) {
+    // Un vértice nuevo está aislado: basta con hacerle lugar, salvo que sea el origen.
+    if (origen < 0 || nroVertice < costos.size()) {
+        recalcular();
+        return;
+    }
+    costos.resize(nroVertice + 1, EspacioConsulta::INFINITO);
+    predecesores.resize(nroVertice + 1, EspacioConsulta::SIN_PREDECESOR);
+    hijos.resize(nroVertice + 1);
+    if (grafo.esDirigido())
+        entrantes.resize(nroVertice + 1);
+    afectados.redimensionar(nroVertice + 1);
+    ultimaReparacion = EstadisticasReparacion();
+    ultimaReparacion.verticesTocados = 1;
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::verticeEliminado(const T &vertice, int nroVertice) {
+    recalcular();
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::aristaInsertada(int nroOrigen, int nroDestino, double distancia,
+                                                        double tiempo) {
+    if (grafo.esDirigido()) {
+        auto &lista = entrantes[nroDestino];
+        if (std::find(lista.begin(), lista.end(), nroOrigen) == lista.end())
+            lista.push_back(nroOrigen);
+    }
+    revisarCambio(nroOrigen, nroDestino);
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::aristaEliminada(int nroOrigen, int nroDestino) {
+    if (grafo.esDirigido()) {
+        auto &lista = entrantes[nroDestino];
+        lista.erase(std::remove(lista.begin(), lista.end(), nroOrigen), lista.end());
+    }
+    revisarCambio(nroOrigen, nroDestino);
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::pesoActualizado(int nroOrigen, int nroDestino, double distanciaAnterior,
+                                                        double tiempoAnterior, double distancia, double tiempo) {
+    revisarCambio(nroOrigen, nroDestino);
+}
+
+template<typename T, typename Politica>
+void ArbolCaminosDinamico<T, Politica>::grafoReemplazado() {
+    recalcular();
+}
@@ -0,0 +1,68 @@
+#ifndef ARBOLEXPANSION_H
+#define ARBOLEXPANSION_H
+#include <cstddef>
+#include <vector>
+
+#include "Componentes.h"
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+
+struct AristaArbol {
+    int origen;
+    int destino;
+    double peso;
+};
+
+// Bosque de expansión mínima: un árbol por componente conexa.
+struct BosqueExpansion {
+    std::vector<AristaArbol> aristas;
+    double pesoTotal = 0;
+    int componentes = 0;
+};
+
+enum class AlgoritmoExpansion { KRUSKAL, PRIM, BORUVKA };
+
+struct ComparacionArbolesExpansion {
+    int vertices = 0;
+    size_t aristas = 0;
+    double segundosKruskal = 0;
+    double segundosPrim = 0;
+    double segundosBoruvka = 0;
+
+    // Aristas por par de vértices; 1 en un grafo completo.
+    double densidad() const {
+        return vertices > 1 ? 2.0 * aristas / (static_cast<double>(vertices) * (vertices - 1)) : 0;
+    }
+
+    AlgoritmoExpansion masRapido() const;
+};
+
+// Los tres algoritmos desempatan pesos iguales por (menor extremo, mayor extremo), así
+// que el bosque es único y todos devuelven las mismas aristas. Sólo grafos no dirigidos;
+// sirven para GrafoPesado (omitiendo lápidas) y GrafoCompacto.
+
+// Ordena las aristas en paralelo y las une con UnionFind.
+template<typename Grafo, typename Politica = PesoDistancia>
+BosqueExpansion kruskal(const Grafo &grafo, Politica peso = Politica(), int hilos = cantidadHilos());
+
+// Crece cada árbol desde un vértice con un montículo binario de aristas candidatas.
+template<typename Grafo, typename Politica = PesoDistancia>
+BosqueExpansion prim(const Grafo &grafo, Politica peso = Politica());
+
+// En cada ronda cada componente elige en paralelo su arista de salida más liviana;
+// hay a lo sumo log2(n) rondas.
+template<typename Grafo, typename Politica = PesoDistancia>
+BosqueExpansion boruvka(const Grafo &grafo, Politica peso = Politica(), int hilos = cantidadHilos());
+
+template<typename Grafo, typename Politica = PesoDistancia>
+BosqueExpansion arbolExpansionMinima(const Grafo &grafo, AlgoritmoExpansion algoritmo,
+                                     Politica peso = Politica(), int hilos = cantidadHilos());
+
+// Mide los tres algoritmos sobre el grafo (mejor de 'repeticiones') para elegir el más
+// rápido según su tamaño y densidad.
+template<typename Grafo, typename Politica = PesoDistancia>
+ComparacionArbolesExpansion compararArbolesExpansion(const Grafo &grafo, Politica peso = Politica(),
+                                                     int hilos = cantidadHilos(), int repeticiones = 3);
+
+#endif //ARBOLEXPANSION_H
+#include "ArbolExpansion.tpp"
@@ -0,0 +1,185 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+// Orden total de las aristas: peso y luego extremos normalizados.
+inline bool aristaMasLiviana(const AristaArbol &a, const AristaArbol &b) {
+    return std::tie(a.peso, a.origen, a.destino) < std::tie(b.peso, b.origen, b.destino);
+}
+
+template<typename Grafo>
+void validarNoDirigido(const Grafo &grafo) {
+    if (grafo.esDirigido())
+        throw std::invalid_argument("El arbol de expansion requiere un grafo no dirigido");
+}
+
+template<typename Grafo>
+int contarVerticesActivos(const Grafo &grafo) {
+    int activos = 0;
+    for (int v = 0; v < grafo.cantidadVertices(); v++)
+        if (esVerticeActivo(grafo, v)) activos++;
+    return activos;
+}
+
+template<typename Grafo, typename Politica>
+BosqueExpansion kruskal(const Grafo &grafo, Politica peso, int hilos) {
+    validarNoDirigido(grafo);
+    const int n = grafo.cantidadVertices();
+    std::vector<AristaArbol> aristas;
+    for (int v = 0; v < n; v++)
+        for (const auto &adyacente: grafo.adyacentesDe(v))
+            if (v < adyacente.indiceVertice)
+                aristas.push_back({v, adyacente.indiceVertice, peso(adyacente)});
+    ordenarParalelo(aristas.begin(), aristas.end(), aristaMasLiviana, hilos);
+
+    BosqueExpansion bosque;
+    bosque.componentes = contarVerticesActivos(grafo);
+    UnionFind conjuntos(n);
+    for (const auto &arista: aristas) {
+        if (!conjuntos.unir(arista.origen, arista.destino)) continue;
+        bosque.aristas.push_back(arista);
+        bosque.pesoTotal += arista.peso;
+        bosque.componentes--;
+    }
+    return bosque;
+}
+
+template<typename Grafo, typename Politica>
+BosqueExpansion prim(const Grafo &grafo, Politica peso) {
+    validarNoDirigido(grafo);
+    const int n = grafo.cantidadVertices();
+    std::vector<bool> enArbol(n, false);
+    // Candidata: arista normalizada y el extremo que todavía no está en el árbol.
+    using Candidata = std::pair<AristaArbol, int>;
+    auto masPesada = [](const Candidata &a, const Candidata &b) { return aristaMasLiviana(b.first, a.first); };
+    std::priority_queue<Candidata, std::vector<Candidata>, decltype(masPesada)> candidatas(masPesada);
+
+    BosqueExpansion bosque;
+    auto agregarVertice = [&](int vertice) {
+        enArbol[vertice] = true;
+        for (const auto &adyacente: grafo.adyacentesDe(vertice)) {
+            int vecino = adyacente.indiceVertice;
+            if (enArbol[vecino]) continue;
+            candidatas.push({{std::min(vertice, vecino), std::max(vertice, vecino), peso(adyacente)}, vecino});
+        }
+    };
+
+    for (int raiz = 0; raiz < n; raiz++) {
+        if (enArbol[raiz] || !esVerticeActivo(grafo, raiz)) continue;
+        bosque.componentes++;
+        agregarVertice(raiz);
+        while (!candidatas.empty()) {
+            auto [arista, nuevo] = candidatas.top();
+            candidatas.pop();
+            if (enArbol[nuevo]) continue;
+            bosque.aristas.push_back(arista);
+            bosque.pesoTotal += arista.peso;
+            agregarVertice(nuevo);
+        }
+    }
+    return bosque;
+}
+
+template<typename Grafo, typename Politica>
+BosqueExpansion boruvka(const Grafo &grafo, Politica peso, int hilos) {
+    validarNoDirigido(grafo);
+    const int n = grafo.cantidadVertices();
+    const AristaArbol NINGUNA{-1, -1, std::numeric_limits<double>::infinity()};
+
+    BosqueExpansion bosque;
+    UnionFind conjuntos(n);
+    std::vector<int> componente(n);
+    for (int v = 0; v < n; v++)
+        componente[v] = v;
+    std::vector<AristaArbol> mejorDeVertice(n);
+    std::vector<AristaArbol> mejorDeComponente(n, NINGUNA);
+
+    bool hayUniones = true;
+    while (hayUniones) {
+        // Cada vértice busca su arista más liviana hacia otra componente (en paralelo);
+        // luego se reduce por componente, que es O(n) y secuencial.
+        paraCadaIndice(n, hilos, [&](size_t i, int) {
+            int v = static_cast<int>(i);
+            AristaArbol mejor = NINGUNA;
+            for (const auto &adyacente: grafo.adyacentesDe(v)) {
+                int vecino = adyacente.indiceVertice;
+                if (componente[vecino] == componente[v]) continue;
+                AristaArbol candidata{std::min(v, vecino), std::max(v, vecino), peso(adyacente)};
+                if (aristaMasLiviana(candidata, mejor))
+                    mejor = candidata;
+            }
+            mejorDeVertice[v] = mejor;
+        }, 1024);
+
+        for (int v = 0; v < n; v++) {
+            AristaArbol &actual = mejorDeComponente[componente[v]];
+            if (mejorDeVertice[v].origen >= 0 && aristaMasLiviana(mejorDeVertice[v], actual))
+                actual = mejorDeVertice[v];
+        }
+
+        // Con orden total no se forman ciclos; unir() descarta la arista que dos
+        // componentes se eligieron mutuamente.
+        hayUniones = false;
+        for (int c = 0; c < n; c++) {
+            AristaArbol &arista = mejorDeComponente[c];
+            if (arista.origen < 0) continue;
+            if (conjuntos.unir(arista.origen, arista.destino)) {
+                bosque.aristas.push_back(arista);
+                bosque.pesoTotal += arista.peso;
+                hayUniones = true;
+            }
+            arista = NINGUNA;
+        }
+
+        paraCadaIndice(n, hilos, [&](size_t i, int) {
+            componente[i] = conjuntos.representante(static_cast<int>(i));
+        }, 4096);
+    }
+
+    bosque.componentes = contarVerticesActivos(grafo) - static_cast<int>(bosque.aristas.size());
+    return bosque;
+}
+
+template<typename Grafo, typename Politica>
+BosqueExpansion arbolExpansionMinima(const Grafo &grafo, AlgoritmoExpansion algoritmo, Politica peso, int hilos) {
+    switch (algoritmo) {
+        case AlgoritmoExpansion::KRUSKAL: return kruskal(grafo, peso, hilos);
+        case AlgoritmoExpansion::PRIM: return prim(grafo, peso);
+        case AlgoritmoExpansion::BORUVKA: return boruvka(grafo, peso, hilos);
+    }
+    throw std::invalid_argument("Algoritmo de arbol de expansion desconocido");
+}
+
+inline AlgoritmoExpansion ComparacionArbolesExpansion::masRapido() const {
+    if (segundosKruskal <= segundosPrim && segundosKruskal <= segundosBoruvka)
+        return AlgoritmoExpansion::KRUSKAL;
+    return segundosPrim <= segundosBoruvka ? AlgoritmoExpansion::PRIM : AlgoritmoExpansion::BORUVKA;
+}
+
+template<typename Grafo, typename Politica>
+ComparacionArbolesExpansion compararArbolesExpansion(const Grafo &grafo, Politica peso, int hilos, int repeticiones) {
+    validarNoDirigido(grafo);
+    ComparacionArbolesExpansion comparacion;
+    comparacion.vertices = contarVerticesActivos(grafo);
+    for (int v = 0; v < grafo.cantidadVertices(); v++)
+        for (const auto &adyacente: grafo.adyacentesDe(v))
+            if (v < adyacente.indiceVertice) comparacion.aristas++;
+
+    auto medir = [&](AlgoritmoExpansion algoritmo) {
+        double mejor = std::numeric_limits<double>::infinity();
+        for (int r = 0; r < std::max(1, repeticiones); r++) {
+            auto inicio = std::chrono::steady_clock::now();
+            arbolExpansionMinima(grafo, algoritmo, peso, hilos);
+            mejor = std::min(mejor, std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count());
+        }
+        return mejor;
+    };
+    comparacion.segundosKruskal = medir(AlgoritmoExpansion::KRUSKAL);
+    comparacion.segundosPrim = medir(AlgoritmoExpansion::PRIM);
+    comparacion.segundosBoruvka = medir(AlgoritmoExpansion::BORUVKA);
+    return comparacion;
+}
@@ -0,0 +1,218 @@
+#include "ArbolKD.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+static double componente(double x, double y, double z, int eje) {
+    return eje == 0 ? x : eje == 1 ? y : z;
+}
+
+ArbolKD::Punto ArbolKD::aPunto(const Coordenada &coordenada, int id, uint32_t version) {
+    constexpr double RADIANES = 3.14159265358979323846 / 180;
+    double latitud = coordenada.latitud * RADIANES, longitud = coordenada.longitud * RADIANES;
+    return {std::cos(latitud) * std::cos(longitud), std::cos(latitud) * std::sin(longitud), std::sin(latitud), id,
+            version};
+}
+
+double ArbolKD::kilometrosDeCuerda(double cuerdaCuadrada) {
+    return 2 * RADIO_TIERRA_KM * std::asin(std::min(1.0, std::sqrt(cuerdaCuadrada) / 2));
+}
+
+void ArbolKD::construirRango(size_t inicio, size_t fin) {
+    if (fin - inicio <= 1) {
+        if (inicio < fin) ejes[inicio] = 0;
+        return;
+    }
+    // Se corta por el eje de mayor extensión del rango.
+    double minimo[3] = {2, 2, 2}, maximo[3] = {-2, -2, -2};
+    for (size_t i = inicio; i < fin; i++) {
+        for (int eje = 0; eje < 3; eje++) {
+            double valor = componente(arbol[i].x, arbol[i].y, arbol[i].z, eje);
+            minimo[eje] = std::min(minimo[eje], valor);
+            maximo[eje] = std::max(maximo[eje], valor);
+        }
+    }
+    int eje = 0;
+    for (int otro = 1; otro < 3; otro++)
+        if (maximo[otro] - minimo[otro] > maximo[eje] - minimo[eje]) eje = otro;
+
+    size_t medio = inicio + (fin - inicio) / 2;
+    std::nth_element(arbol.begin() + inicio, arbol.begin() + medio, arbol.begin() + fin,
+                     [eje](const Punto &a, const Punto &b) {
+                         return componente(a.x, a.y, a.z, eje) < componente(b.x, b.y, b.z, eje);
+                     });
+    ejes[medio] = eje;
+    construirRango(inicio, medio);
+    construirRango(medio + 1, fin);
+}
+
+void ArbolKD::reconstruir() {
+    std::vector<Punto> puntos;
+    puntos.reserve(vigentes);
+    for (const auto *lista: {&arbol, &pendientes})
+        for (const auto &punto: *lista)
+            if (esVigente(punto)) puntos.push_back(punto);
+    arbol = std::move(puntos);
+    pendientes.clear();
+    obsoletos = 0;
+    ejes.assign(arbol.size(), 0);
+    construirRango(0, arbol.size());
+}
+
+void ArbolKD::reconstruirSiConviene() {
+    if (pendientes.size() > 32 + arbol.size() / 8 || obsoletos > 32 + vigentes)
+        reconstruir();
+}
+
+template<typename Visitar>
+void ArbolKD::recorrer(size_t inicio, size_t fin, const Punto &consulta, double &cota, Visitar &&visitar) const {
+    if (inicio >= fin) return;
+    size_t medio = inicio + (fin - inicio) / 2;
+    const Punto &punto = arbol[medio];
+    double dx = punto.x - consulta.x, dy = punto.y - consulta.y, dz = punto.z - consulta.z;
+    double distancia = dx * dx + dy * dy + dz * dz;
+    if (distancia <= cota && esVigente(punto))
+        visitar(punto, distancia);
+
+    int eje = ejes[medio];
+    double diferencia = componente(consulta.x, consulta.y, consulta.z, eje) -
+                        componente(punto.x, punto.y, punto.z, eje);
+    if (diferencia < 0) {
+        recorrer(inicio, medio, consulta, cota, visitar);
+        if (diferencia * diferencia <= cota) recorrer(medio + 1, fin, consulta, cota, visitar);
+    } else {
+        recorrer(medio + 1, fin, consulta, cota, visitar);
+        if (diferencia * diferencia <= cota) recorrer(inicio, medio, consulta, cota, visitar);
+    }
+}
+
+void ArbolKD::cargar(const std::vector<Coordenada> &coordenadas) {
+    versiones.assign(coordenadas.size(), 0);
+    arbol.clear();
+    pendientes.clear();
+    for (size_t id = 0; id < coordenadas.size(); id++) {
+        if (!coordenadas[id].esValida()) continue;
+        versiones[id] = ++ultimaVersion;
+        arbol.push_back(aPunto(coordenadas[id], id, versiones[id]));
+    }
+    vigentes = arbol.size();
+    obsoletos = 0;
+    ejes.assign(arbol.size(), 0);
+    construirRango(0, arbol.size());
+}
+
+void ArbolKD::insertar(int id, const Coordenada &coordenada) {
+    if (id < 0)
+        throw std::invalid_argument("Id de punto invalido");
+    if (!coordenada.esValida()) {
+        quitar(id);
+        return;
+    }
+    if (id >= static_cast<int>(versiones.size()))
+        versiones.resize(id + 1, 0);
+    if (versiones[id] != 0)
+        obsoletos++;
+    else
+        vigentes++;
+    versiones[id] = ++ultimaVersion;
+    pendientes.push_back(aPunto(coordenada, id, versiones[id]));
+    reconstruirSiConviene();
+}
+
+void ArbolKD::quitar(int id) {
+    if (id < 0 || id >= static_cast<int>(versiones.size()) || versiones[id] == 0)
+        return;
+    versiones[id] = 0;
+    vigentes--;
+    obsoletos++;
+    reconstruirSiConviene();
+}
+
+void ArbolKD::quitarYRenumerar(int id) {
+    if (id < 0 || id >= static_cast<int>(versiones.size()))
+        return;
+    if (versiones[id] != 0) {
+        vigentes--;
+        obsoletos++;
+    }
+    versiones.erase(versiones.begin() + id);
+    // Renumerar no mueve ningún punto, así que la forma del árbol sigue valiendo.
+    for (auto *lista: {&arbol, &pendientes}) {
+        for (auto &punto: *lista) {
+            if (punto.id == id)
+                punto.version = 0;
+            else if (punto.id > id)
+                punto.id--;
+        }
+    }
+    reconstruirSiConviene();
+}
+
+std::vector<VecinoCercano> ArbolKD::masCercanos(const Coordenada &punto, int cantidad) const {
+    if (!punto.esValida())
+        throw std::invalid_argument("Coordenada invalida");
+    std::vector<VecinoCercano> resultado;
+    if (cantidad <= 0) return resultado;
+
+    // Montículo de máximos con los mejores hasta ahora; la cota es el peor de ellos.
+    std::priority_queue<std::pair<double, int> > mejores;
+    double cota = std::numeric_limits<double>::infinity();
+    auto visitar = [&](const Punto &candidato, double distancia) {
+        std::pair<double, int> entrada(distancia, candidato.id);
+        if (static_cast<int>(mejores.size()) == cantidad) {
+            if (entrada >= mejores.top()) return;
+            mejores.pop();
+        }
+        mejores.push(entrada);
+        if (static_cast<int>(mejores.size()) == cantidad)
+            cota = mejores.top().first;
+    };
+    Punto consulta = aPunto(punto, -1, 0);
+    recorrer(0, arbol.size(), consulta, cota, visitar);
+    for (const auto &pendiente: pendientes) {
+        double dx = pendiente.x - consulta.x, dy = pendiente.y - consulta.y, dz = pendiente.z - consulta.z;
+        double distancia = dx * dx + dy * dy + dz * dz;
+        if (distancia <= cota && esVigente(pendiente))
+            visitar(pendiente, distancia);
+    }
+
+    resultado.resize(mejores.size());
+    for (size_t i = resultado.size(); i-- > 0; mejores.pop())
+        resultado[i] = {mejores.top().second, kilometrosDeCuerda(mejores.top().first)};
+    return resultado;
+}
+
+std::vector<VecinoCercano> ArbolKD::dentroDeRadio(const Coordenada &punto, double kilometros) const {
+    if (!punto.esValida())
+        throw std::invalid_argument("Coordenada invalida");
+    if (kilometros < 0)
+        throw std::invalid_argument("El radio no puede ser negativo");
+    // Cuerda del ángulo kilometros / R; más de media vuelta abarca toda la esfera.
+    double angulo = kilometros / RADIO_TIERRA_KM;
+    double cota = angulo >= 3.14159265358979323846 ? 4 : std::pow(2 * std::sin(angulo / 2), 2);
+    cota *= 1 + 1e-12;
+
+    std::vector<std::pair<double, int> > encontrados;
+    auto visitar = [&](const Punto &candidato, double distancia) {
+        encontrados.emplace_back(distancia, candidato.id);
+    };
+    Punto consulta = aPunto(punto, -1, 0);
+    recorrer(0, arbol.size(), consulta, cota, visitar);
+    for (const auto &pendiente: pendientes) {
+        double dx = pendiente.x - consulta.x, dy = pendiente.y - consulta.y, dz = pendiente.z - consulta.z;
+        double distancia = dx * dx + dy * dy + dz * dz;
+        if (distancia <= cota && esVigente(pendiente))
+            visitar(pendiente, distancia);
+    }
+
+    std::sort(encontrados.begin(), encontrados.end());
+    std::vector<VecinoCercano> resultado;
+    resultado.reserve(encontrados.size());
+    for (const auto &[distancia, id]: encontrados)
+        resultado.push_back({id, kilometrosDeCuerda(distancia)});
+    return resultado;
+}
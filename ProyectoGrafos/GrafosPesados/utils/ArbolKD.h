@@ -0,0 +1,75 @@
+#ifndef ARBOLKD_H
+#define ARBOLKD_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../Coordenada.h"
+
+struct VecinoCercano {
+    int vertice;
+    double kilometros;
+};
+
+// Árbol k-d sobre los puntos (x, y, z) de la esfera unidad. La distancia de cuerda crece
+// con la de gran círculo, así que los vecinos por una son los vecinos por la otra y el
+// índice no se rompe en el antimeridiano ni en los polos. El árbol es implícito: la raíz
+// de un rango [inicio, fin) es su punto medio. Las inserciones esperan en una lista que
+// se recorre entera en cada consulta y las bajas sólo invalidan la versión del punto;
+// cuando cualquiera de las dos crece demasiado se reconstruye todo en O(n log n).
+class ArbolKD {
+    struct Punto {
+        double x, y, z;
+        int id;
+        uint32_t version;
+    };
+
+    std::vector<Punto> arbol;
+    std::vector<uint8_t> ejes;
+    std::vector<Punto> pendientes;
+    // Versión vigente de cada id; 0 si no tiene punto.
+    std::vector<uint32_t> versiones;
+    uint32_t ultimaVersion = 0;
+    size_t vigentes = 0;
+    size_t obsoletos = 0;
+
+    static Punto aPunto(const Coordenada &coordenada, int id, uint32_t version);
+
+    static double kilometrosDeCuerda(double cuerdaCuadrada);
+
+    bool esVigente(const Punto &punto) const {
+        return punto.version != 0 && versiones[punto.id] == punto.version;
+    }
+
+    void construirRango(size_t inicio, size_t fin);
+
+    void reconstruir();
+
+    void reconstruirSiConviene();
+
+    template<typename Visitar>
+    void recorrer(size_t inicio, size_t fin, const Punto &consulta, double &cota, Visitar &&visitar) const;
+
+public:
+    // 'coordenadas' indexado por id; las no válidas quedan fuera.
+    void cargar(const std::vector<Coordenada> &coordenadas);
+
+    // Ubica o mueve el punto de 'id'.
+    void insertar(int id, const Coordenada &coordenada);
+
+    void quitar(int id);
+
+    // Quita 'id' y corre los ids mayores un lugar hacia abajo, como GrafoPesado al
+    // eliminar un vértice sin ids estables.
+    void quitarYRenumerar(int id);
+
+    size_t cantidad() const { return vigentes; }
+
+    // Los 'cantidad' puntos más cercanos, del más cercano al más lejano.
+    std::vector<VecinoCercano> masCercanos(const Coordenada &punto, int cantidad) const;
+
+    // Puntos a no más de 'kilometros', del más cercano al más lejano.
+    std::vector<VecinoCercano> dentroDeRadio(const Coordenada &punto, double kilometros) const;
+};
+
+#endif //ARBOLKD_H
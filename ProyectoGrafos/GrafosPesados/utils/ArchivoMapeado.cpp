@@ -0,0 +1,76 @@
+#include "ArchivoMapeado.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ArchivoMapeado::ArchivoMapeado(const std::string &ruta) : descriptor(-1), datos(nullptr), tamano(0) {
+    descriptor = open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        throw std::runtime_error("No se pudo abrir el archivo: " + ruta);
+
+    struct stat informacion{};
+    if (fstat(descriptor, &informacion) != 0) {
+        close(descriptor);
+        throw std::runtime_error("No se pudo leer el tamaño del archivo: " + ruta);
+    }
+
+    tamano = informacion.st_size;
+    if (tamano == 0)
+        return;
+
+    void *mapeo = mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapeo == MAP_FAILED) {
+        close(descriptor);
+        throw std::runtime_error("No se pudo mapear el archivo: " + ruta);
+    }
+    datos = static_cast<const char *>(mapeo);
+}
+
+ArchivoMapeado::~ArchivoMapeado() {
+    if (datos != nullptr)
+        munmap(const_cast<char *>(datos), tamano);
+    if (descriptor >= 0)
+        close(descriptor);
+}
+
+void ArchivoMapeado::lecturaSecuencial() const {
+    if (datos != nullptr)
+        madvise(const_cast<char *>(datos), tamano, MADV_SEQUENTIAL);
+}
+
+void ArchivoMapeado::liberarHasta(size_t desplazamiento) const {
+    if (datos == nullptr)
+        return;
+    size_t pagina = sysconf(_SC_PAGESIZE);
+    size_t limite = std::min(desplazamiento, tamano) / pagina * pagina;
+    if (limite > 0)
+        madvise(const_cast<char *>(datos), limite, MADV_DONTNEED);
+}
+
+static void sincronizar(const std::string &ruta, int banderas) {
+    int descriptor = open(ruta.c_str(), banderas);
+    if (descriptor < 0)
+        throw std::runtime_error("No se pudo abrir para sincronizar: " + ruta);
+    int resultado = fsync(descriptor);
+    close(descriptor);
+    if (resultado != 0)
+        throw std::runtime_error("No se pudo sincronizar con el disco: " + ruta);
+}
+
+void sincronizarDirectorioDe(const std::string &ruta) {
+    size_t barra = ruta.find_last_of('/');
+    std::string directorio = barra == std::string::npos ? "." : barra == 0 ? "/" : ruta.substr(0, barra);
+    sincronizar(directorio, O_RDONLY | O_DIRECTORY);
+}
+
+void reemplazarArchivo(const std::string &temporal, const std::string &ruta) {
+    sincronizar(temporal, O_RDONLY);
+    if (std::rename(temporal.c_str(), ruta.c_str()) != 0)
+        throw std::runtime_error("No se pudo reemplazar el archivo: " + ruta);
+    sincronizarDirectorioDe(ruta);
+}
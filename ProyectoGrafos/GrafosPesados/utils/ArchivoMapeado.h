@@ -0,0 +1,40 @@
+#ifndef ARCHIVOMAPEADO_H
+#define ARCHIVOMAPEADO_H
+#include <cstddef>
+#include <string>
+
+// Archivo de solo lectura proyectado en memoria con mmap.
+class ArchivoMapeado {
+private:
+    int descriptor;
+    const char *datos;
+    size_t tamano;
+
+public:
+    explicit ArchivoMapeado(const std::string &ruta);
+
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado &) = delete;
+
+    ArchivoMapeado &operator=(const ArchivoMapeado &) = delete;
+
+    const char *getDatos() const { return datos; }
+
+    size_t getTamano() const { return tamano; }
+
+    // Indica al kernel que el archivo se leerá secuencialmente.
+    void lecturaSecuencial() const;
+
+    // Descarta las páginas ya procesadas para mantener acotada la memoria residente.
+    void liberarHasta(size_t desplazamiento) const;
+};
+
+// Hace persistentes las altas, bajas y renombres en el directorio que contiene 'ruta'.
+void sincronizarDirectorioDe(const std::string &ruta);
+
+// Sincroniza 'temporal' con el disco, lo renombra a 'ruta' y sincroniza el directorio:
+// tras una caída queda el archivo anterior o el nuevo completo, nunca uno vacío.
+void reemplazarArchivo(const std::string &temporal, const std::string &ruta);
+
+#endif //ARCHIVOMAPEADO_H
@@ -0,0 +1,73 @@
+#ifndef CAMINORESTRINGIDO_H
+#define CAMINORESTRINGIDO_H
+#include <cstddef>
+#include <vector>
+
+#include "../BusquedaCaminos.h"
+#include "../GrafoCompacto.h"
+
+enum class EstadoRestringido {
+    OPTIMO,
+    SIN_SOLUCION,
+    LIMITE_ETIQUETAS,
+    LIMITE_TIEMPO
+};
+
+// Cortes para que una consulta difícil se degrade en lugar de agotar memoria o tiempo.
+struct LimitesRestringido {
+    size_t maxEtiquetas = 5000000;
+    double maxSegundos = 5;
+};
+
+struct ResultadoRestringido {
+    EstadoRestringido estado = EstadoRestringido::SIN_SOLUCION;
+    // Con un límite alcanzado, el mejor camino factible encontrado (puede estar vacío).
+    std::vector<int> camino;
+    double distancia = EspacioConsulta::INFINITO;
+    double tiempo = EspacioConsulta::INFINITO;
+    size_t etiquetasCreadas = 0;
+    double segundos = 0;
+
+    bool existeCamino() const { return !camino.empty(); }
+};
+
+// Camino de menor distancia cuyo tiempo total no supera un presupuesto.
+// Búsqueda por etiquetas (distancia, tiempo) con poda por dominancia de Pareto en
+// cada vértice. Dos búsquedas inversas desde el destino dan cotas inferiores exactas
+// de distancia y de tiempo: una etiqueta se descarta si ni con la cota de tiempo
+// llega a tiempo, o si ni con la de distancia mejora el mejor camino conocido.
+// El grafo debe vivir mientras se use el objeto.
+template<typename T>
+class CaminoRestringido {
+    struct Etiqueta {
+        double distancia;
+        double tiempo;
+        int vertice;
+        int padre;
+        bool activa;
+    };
+
+private:
+    const GrafoCompacto<T> &grafo;
+    GrafoCompacto<T> inverso;
+    LimitesRestringido limites;
+
+    // Camino desde 'origen' siguiendo el árbol de una búsqueda inversa hacia su raíz.
+    template<typename Politica, typename Filtro>
+    ResultadoRestringido seguirArbolInverso(int origen, const EspacioConsulta &arbol, Politica peso,
+                                            const Filtro &filtro) const;
+
+public:
+    explicit CaminoRestringido(const GrafoCompacto<T> &grafo, LimitesRestringido limites = LimitesRestringido());
+
+    void setLimites(const LimitesRestringido &limites) { this->limites = limites; }
+
+    const LimitesRestringido &getLimites() const { return limites; }
+
+    template<typename Filtro = SinFiltro>
+    ResultadoRestringido consultar(int origen, int destino, double tiempoMaximo,
+                                   const Filtro &filtro = Filtro()) const;
+};
+
+#endif //CAMINORESTRINGIDO_H
+#include "CaminoRestringido.tpp"
@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+
+template<typename T>
+CaminoRestringido<T>::CaminoRestringido(const GrafoCompacto<T> &grafo, LimitesRestringido limites)
+    : grafo(grafo), inverso(grafo.transpuesto()), limites(limites) {
+}
+
+template<typename T>
+template<typename Politica, typename Filtro>
+ResultadoRestringido CaminoRestringido<T>::seguirArbolInverso(int origen, const EspacioConsulta &arbol,
+                                                              Politica peso, const Filtro &filtro) const {
+    ResultadoRestringido resultado;
+    if (!arbol.fueAlcanzado(origen))
+        return resultado;
+
+    resultado.distancia = 0;
+    resultado.tiempo = 0;
+    int actual = origen;
+    resultado.camino.push_back(actual);
+    while (arbol.getPredecesor(actual) != EspacioConsulta::SIN_PREDECESOR) {
+        int siguiente = arbol.getPredecesor(actual);
+        // Entre arcos paralelos, el que dio el costo del árbol.
+        const AdyacenteConPeso *elegido = nullptr;
+        for (const auto &arco: grafo.adyacentesDe(actual)) {
+            if (arco.indiceVertice == siguiente && arbol.getCosto(siguiente) + peso(arco) == arbol.getCosto(actual) &&
+                filtro.permiteArco(actual, arco))
+                elegido = &arco;
+        }
+        if (!elegido)
+            throw std::logic_error("Arbol inverso inconsistente con el grafo");
+        resultado.distancia += elegido->distancia;
+        resultado.tiempo += elegido->tiempo;
+        resultado.camino.push_back(siguiente);
+        actual = siguiente;
+    }
+    return resultado;
+}
+
+template<typename T>
+template<typename Filtro>
+ResultadoRestringido CaminoRestringido<T>::consultar(int origen, int destino, double tiempoMaximo,
+                                                     const Filtro &filtro) const {
+    auto inicio = std::chrono::steady_clock::now();
+    auto segundosTranscurridos = [&inicio]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    };
+
+    int n = grafo.cantidadVertices();
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n)
+        throw std::invalid_argument("Vertice invalido");
+
+    // Cotas inferiores exactas hacia el destino, por distancia y por tiempo.
+    EspacioConsulta cotaDistancia, cotaTiempo;
+    // Con el mismo filtro, para que las cotas sigan siendo válidas.
+    FiltroInverso<Filtro> filtroInverso(filtro);
+    buscarCaminos(inverso, destino, cotaDistancia, PesoDistancia(), SinParada(), VisitanteNulo(), filtroInverso);
+    buscarCaminos(inverso, destino, cotaTiempo, PesoTiempo(), SinParada(), VisitanteNulo(), filtroInverso);
+
+    ResultadoRestringido mejor;
+    if (cotaTiempo.getCosto(origen) > tiempoMaximo) {
+        mejor.segundos = segundosTranscurridos();
+        return mejor;
+    }
+
+    // Si el camino más corto ya cumple el presupuesto, no hace falta buscar.
+    mejor = seguirArbolInverso(origen, cotaDistancia, PesoDistancia(), filtro);
+    if (mejor.tiempo <= tiempoMaximo) {
+        mejor.estado = EstadoRestringido::OPTIMO;
+        mejor.segundos = segundosTranscurridos();
+        return mejor;
+    }
+    // El camino más rápido es factible y sirve de primera cota superior.
+    mejor = seguirArbolInverso(origen, cotaTiempo, PesoTiempo(), filtro);
+
+    std::vector<Etiqueta> etiquetas;
+    std::vector<std::vector<int> > frentes(n);
+    // (distancia + cota, tiempo, etiqueta): se expande primero la de menor distancia estimada.
+    using Entrada = std::tuple<double, double, int>;
+    std::vector<Entrada> monticulo;
+    EstadoRestringido limite = EstadoRestringido::OPTIMO;
+
+    auto crearEtiqueta = [&](double distancia, double tiempo, int vertice, int padre) {
+        if (tiempo + cotaTiempo.getCosto(vertice) > tiempoMaximo ||
+            distancia + cotaDistancia.getCosto(vertice) >= mejor.distancia)
+            return;
+
+        // Una etiqueta que llega al destino es factible: pasa a ser el mejor camino conocido.
+        if (vertice == destino) {
+            mejor = ResultadoRestringido();
+            mejor.distancia = distancia;
+            mejor.tiempo = tiempo;
+            mejor.camino.push_back(destino);
+            for (int actual = padre; actual != -1; actual = etiquetas[actual].padre)
+                mejor.camino.push_back(etiquetas[actual].vertice);
+            std::reverse(mejor.camino.begin(), mejor.camino.end());
+            return;
+        }
+
+        // El frente está ordenado por distancia creciente y tiempo decreciente.
+        std::vector<int> &frente = frentes[vertice];
+        auto porDistancia = [&etiquetas](int etiqueta, double valor) {
+            return etiquetas[etiqueta].distancia < valor;
+        };
+        auto primeraMayor = std::upper_bound(frente.begin(), frente.end(), distancia,
+                                             [&etiquetas](double valor, int etiqueta) {
+                                                 return valor < etiquetas[etiqueta].distancia;
+                                             });
+        if (primeraMayor != frente.begin() && etiquetas[*(primeraMayor - 1)].tiempo <= tiempo)
+            return;
+
+        auto desde = std::lower_bound(frente.begin(), frente.end(), distancia, porDistancia);
+        auto hasta = desde;
+        while (hasta != frente.end() && etiquetas[*hasta].tiempo >= tiempo) {
+            etiquetas[*hasta].activa = false;
+            ++hasta;
+        }
+        int nueva = etiquetas.size();
+        etiquetas.push_back({distancia, tiempo, vertice, padre, true});
+        frente.insert(frente.erase(desde, hasta), nueva);
+
+        monticulo.emplace_back(distancia + cotaDistancia.getCosto(vertice), tiempo, nueva);
+        std::push_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+        if (etiquetas.size() >= limites.maxEtiquetas)
+            limite = EstadoRestringido::LIMITE_ETIQUETAS;
+    };
+
+    crearEtiqueta(0, 0, origen, -1);
+    size_t extracciones = 0;
+    while (!monticulo.empty() && limite == EstadoRestringido::OPTIMO) {
+        std::pop_heap(monticulo.begin(), monticulo.end(), std::greater<>());
+        auto [clave, tiempoEntrada, indice] = monticulo.back();
+        monticulo.pop_back();
+        if (!etiquetas[indice].activa)
+            continue;
+        // Ninguna etiqueta pendiente puede mejorar el mejor camino conocido: es óptimo.
+        if (clave >= mejor.distancia)
+            break;
+
+        const Etiqueta etiqueta = etiquetas[indice];
+        for (const auto &arco: grafo.adyacentesDe(etiqueta.vertice)) {
+            if (!filtro.permiteVertice(arco.indiceVertice) || !filtro.permiteArco(etiqueta.vertice, arco))
+                continue;
+            crearEtiqueta(etiqueta.distancia + arco.distancia, etiqueta.tiempo + arco.tiempo, arco.indiceVertice,
+                          indice);
+        }
+
+        if (++extracciones % 1024 == 0 && segundosTranscurridos() > limites.maxSegundos)
+            limite = EstadoRestringido::LIMITE_TIEMPO;
+    }
+
+    if (limite != EstadoRestringido::OPTIMO)
+        mejor.estado = limite;
+    else
+        mejor.estado = mejor.existeCamino() ? EstadoRestringido::OPTIMO : EstadoRestringido::SIN_SOLUCION;
+    mejor.etiquetasCreadas = etiquetas.size();
+    mejor.segundos = segundosTranscurridos();
+    return mejor;
+}
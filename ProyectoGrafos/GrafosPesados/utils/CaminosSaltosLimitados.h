@@ -0,0 +1,71 @@
+#ifndef CAMINOSSALTOSLIMITADOS_H
+#define CAMINOSSALTOSLIMITADOS_H
+#include <utility>
+#include <vector>
+
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+#include "../GrafoCompacto.h"
+
+struct ResultadoSaltos {
+    // costoPorSaltos[h]: costo mínimo usando a lo sumo h arcos (INFINITO si no hay camino).
+    std::vector<double> costoPorSaltos;
+    // Camino óptimo con a lo sumo maxArcos arcos; entre los óptimos, el de menos arcos.
+    std::vector<int> camino;
+    double costo = EspacioConsulta::INFINITO;
+
+    bool existeCamino() const { return !camino.empty(); }
+
+    // Un camino con h arcos tiene h - 1 escalas.
+    int escalas() const { return camino.empty() ? -1 : static_cast<int>(camino.size()) - 2; }
+};
+
+// Caminos mínimos con un máximo de arcos ("a lo sumo k escalas" = k + 1 arcos).
+// Bellman-Ford sincronizado por niveles sobre el CSR: el nivel h sólo relaja los
+// arcos de los vértices que mejoraron en el nivel h - 1, con dos arreglos de costos
+// que se alternan y un arreglo de predecesores por nivel para reconstruir el camino.
+// El grafo debe vivir mientras se use el objeto.
+template<typename T, typename Politica = PesoDistancia>
+class CaminosSaltosLimitados {
+    struct EspacioSaltos {
+        std::vector<double> anterior;
+        std::vector<double> actual;
+        std::vector<std::vector<int> > predecesores;
+        std::vector<int> frontera;
+        std::vector<int> siguiente;
+        MarcadoEpoca enSiguiente;
+    };
+
+private:
+    const GrafoCompacto<T> &grafo;
+    Politica peso;
+
+    // costosDestinos[i][h]: costo de destinos[i] con a lo sumo h arcos.
+    template<typename Filtro>
+    void ejecutarNiveles(int origen, int maxArcos, const std::vector<int> &destinos, EspacioSaltos &espacio,
+                         std::vector<std::vector<double> > &costosDestinos, const Filtro &filtro) const;
+
+    ResultadoSaltos construirResultado(int origen, int destino, const EspacioSaltos &espacio,
+                                       std::vector<double> costosPorNivel) const;
+
+public:
+    explicit CaminosSaltosLimitados(const GrafoCompacto<T> &grafo, Politica peso = Politica());
+
+    template<typename Filtro = SinFiltro>
+    ResultadoSaltos consultar(int origen, int destino, int maxArcos, const Filtro &filtro = Filtro()) const;
+
+    template<typename Filtro = SinFiltro>
+    ResultadoSaltos consultarPorEscalas(int origen, int destino, int maxEscalas,
+                                        const Filtro &filtro = Filtro()) const {
+        return consultar(origen, destino, maxEscalas + 1, filtro);
+    }
+
+    // Resuelve muchos pares (origen, destino): una pasada por origen distinto, en paralelo.
+    // El filtro se comparte entre los hilos (sólo se lee).
+    template<typename Filtro = SinFiltro>
+    std::vector<ResultadoSaltos> consultarLote(const std::vector<std::pair<int, int> > &pares, int maxArcos,
+                                               int hilos = cantidadHilos(), const Filtro &filtro = Filtro()) const;
+};
+
+#endif //CAMINOSSALTOSLIMITADOS_H
+#include "CaminosSaltosLimitados.tpp"
@@ -0,0 +1,148 @@
+#pragma once
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+template<typename T, typename Politica>
+CaminosSaltosLimitados<T, Politica>::CaminosSaltosLimitados(const GrafoCompacto<T> &grafo, Politica peso)
+    : grafo(grafo), peso(peso) {
+}
+
+template<typename T, typename Politica>
+template<typename Filtro>
+void CaminosSaltosLimitados<T, Politica>::ejecutarNiveles(int origen, int maxArcos, const std::vector<int> &destinos,
+                                                          EspacioSaltos &espacio,
+                                                          std::vector<std::vector<double> > &costosDestinos,
+                                                          const Filtro &filtro) const {
+    int n = grafo.cantidadVertices();
+    if (origen < 0 || origen >= n)
+        throw std::invalid_argument("Vertice de origen invalido");
+    if (maxArcos < 0)
+        throw std::invalid_argument("La cantidad de arcos no puede ser negativa");
+    for (int destino: destinos) {
+        if (destino < 0 || destino >= n)
+            throw std::invalid_argument("Vertice de destino invalido");
+    }
+
+    espacio.anterior.assign(n, EspacioConsulta::INFINITO);
+    espacio.predecesores.resize(maxArcos + 1);
+    espacio.enSiguiente.redimensionar(n);
+    espacio.frontera.clear();
+    if (filtro.permiteVertice(origen)) {
+        espacio.anterior[origen] = 0;
+        espacio.frontera.push_back(origen);
+    }
+    espacio.actual = espacio.anterior;
+
+    costosDestinos.assign(destinos.size(), std::vector<double>());
+    auto registrarNivel = [&]() {
+        for (size_t i = 0; i < destinos.size(); i++)
+            costosDestinos[i].push_back(espacio.anterior[destinos[i]]);
+    };
+    registrarNivel();
+
+    for (int nivel = 1; nivel <= maxArcos; nivel++) {
+        std::vector<int> &predecesores = espacio.predecesores[nivel];
+        predecesores.assign(n, EspacioConsulta::SIN_PREDECESOR);
+        espacio.siguiente.clear();
+        espacio.enSiguiente.reiniciar();
+
+        // Sólo relajan los vértices que mejoraron en el nivel anterior.
+        for (int u: espacio.frontera) {
+            double costo = espacio.anterior[u];
+            for (const auto &arco: grafo.adyacentesDe(u)) {
+                int v = arco.indiceVertice;
+                if (!filtro.permiteVertice(v) || !filtro.permiteArco(u, arco)) continue;
+                double nuevoCosto = costo + peso(arco);
+                bool empateMenor = nuevoCosto == espacio.actual[v] &&
+                                   predecesores[v] != EspacioConsulta::SIN_PREDECESOR && u < predecesores[v];
+                if (nuevoCosto < espacio.actual[v] || empateMenor) {
+                    espacio.actual[v] = nuevoCosto;
+                    predecesores[v] = u;
+                    if (!espacio.enSiguiente.estaMarcado(v)) {
+                        espacio.enSiguiente.marcar(v);
+                        espacio.siguiente.push_back(v);
+                    }
+                }
+            }
+        }
+        // Los dos buffers sólo difieren en los vértices mejorados.
+        for (int v: espacio.siguiente)
+            espacio.anterior[v] = espacio.actual[v];
+        std::swap(espacio.frontera, espacio.siguiente);
+        registrarNivel();
+
+        if (espacio.frontera.empty()) {
+            for (int resto = nivel + 1; resto <= maxArcos; resto++)
+                registrarNivel();
+            break;
+        }
+    }
+}
+
+template<typename T, typename Politica>
+ResultadoSaltos CaminosSaltosLimitados<T, Politica>::construirResultado(int origen, int destino,
+                                                                        const EspacioSaltos &espacio,
+                                                                        std::vector<double> costosPorNivel) const {
+    ResultadoSaltos resultado;
+    resultado.costoPorSaltos = std::move(costosPorNivel);
+    int mejorNivel = -1;
+    for (int nivel = 0; nivel < resultado.costoPorSaltos.size(); nivel++) {
+        if (resultado.costoPorSaltos[nivel] < resultado.costo) {
+            resultado.costo = resultado.costoPorSaltos[nivel];
+            mejorNivel = nivel;
+        }
+    }
+    if (mejorNivel < 0)
+        return resultado;
+
+    // En un nivel sin mejora el vértice conserva el camino del nivel anterior.
+    int actual = destino;
+    for (int nivel = mejorNivel; nivel > 0; nivel--) {
+        int predecesor = espacio.predecesores[nivel][actual];
+        if (predecesor != EspacioConsulta::SIN_PREDECESOR) {
+            resultado.camino.push_back(actual);
+            actual = predecesor;
+        }
+    }
+    resultado.camino.push_back(origen);
+    std::reverse(resultado.camino.begin(), resultado.camino.end());
+    return resultado;
+}
+
+template<typename T, typename Politica>
+template<typename Filtro>
+ResultadoSaltos CaminosSaltosLimitados<T, Politica>::consultar(int origen, int destino, int maxArcos,
+                                                               const Filtro &filtro) const {
+    EspacioSaltos espacio;
+    std::vector<std::vector<double> > costosDestinos;
+    ejecutarNiveles(origen, maxArcos, {destino}, espacio, costosDestinos, filtro);
+    return construirResultado(origen, destino, espacio, std::move(costosDestinos[0]));
+}
+
+template<typename T, typename Politica>
+template<typename Filtro>
+std::vector<ResultadoSaltos> CaminosSaltosLimitados<T, Politica>::consultarLote(
+    const std::vector<std::pair<int, int> > &pares, int maxArcos, int hilos, const Filtro &filtro) const {
+    // Agrupa los pares por origen: una sola pasada de niveles responde todos sus destinos.
+    std::map<int, std::vector<int> > paresPorOrigen;
+    for (int i = 0; i < pares.size(); i++)
+        paresPorOrigen[pares[i].first].push_back(i);
+    std::vector<std::pair<int, std::vector<int> > > grupos(paresPorOrigen.begin(), paresPorOrigen.end());
+
+    std::vector<ResultadoSaltos> resultados(pares.size());
+    std::vector<EspacioSaltos> espacios(std::max(1, hilos));
+    paraCadaIndice(grupos.size(), hilos, [&](size_t g, int idHilo) {
+        const auto &[origen, indices] = grupos[g];
+        std::vector<int> destinos;
+        for (int indice: indices)
+            destinos.push_back(pares[indice].second);
+
+        std::vector<std::vector<double> > costosDestinos;
+        ejecutarNiveles(origen, maxArcos, destinos, espacios[idHilo], costosDestinos, filtro);
+        for (size_t i = 0; i < indices.size(); i++)
+            resultados[indices[i]] = construirResultado(origen, destinos[i], espacios[idHilo],
+                                                        std::move(costosDestinos[i]));
+    }, 1);
+    return resultados;
+}
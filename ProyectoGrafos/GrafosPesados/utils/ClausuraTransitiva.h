@@ -0,0 +1,53 @@
+#ifndef CLAUSURATRANSITIVA_H
+#define CLAUSURATRANSITIVA_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Componentes.h"
+#include "Paralelo.h"
+
+// Índice de alcanzabilidad: una fila de bits por componente fuertemente conexa de la
+// condensación, así que "¿X llega a Y?" es un acceso a memoria y una prueba de bit.
+// Todos los vértices de una componente comparten fila. Con C componentes ocupa C²/8
+// bytes frente a los 8·n² de la matriz de pesos de FloydWarshall (1/64 si C = n).
+class ClausuraTransitiva {
+private:
+    std::vector<int> componente;
+    int cantidadComponentes;
+    size_t palabrasPorFila;
+    std::vector<uint64_t> filas;
+    double segundosConstruccion;
+
+    uint64_t *fila(int c) { return filas.data() + c * palabrasPorFila; }
+
+    const uint64_t *fila(int c) const { return filas.data() + c * palabrasPorFila; }
+
+public:
+    // Las componentes de un mismo nivel de la condensación (misma distancia máxima a
+    // un sumidero) no dependen entre sí y se calculan en paralelo.
+    template<typename Grafo>
+    explicit ClausuraTransitiva(const Grafo &grafo, int hilos = cantidadHilos());
+
+    bool alcanza(int nroOrigen, int nroDestino) const {
+        int desde = componente[nroOrigen];
+        int hasta = componente[nroDestino];
+        if (desde < 0 || hasta < 0)
+            return false;
+        return (fila(desde)[hasta >> 6] >> (hasta & 63)) & 1;
+    }
+
+    // Vértices alcanzables desde el origen, incluido él mismo.
+    std::vector<int> alcanzablesDesde(int nroOrigen) const;
+
+    int getComponente(int nroVertice) const { return componente[nroVertice]; }
+
+    int getCantidadComponentes() const { return cantidadComponentes; }
+
+    size_t bytes() const { return filas.size() * sizeof(uint64_t) + componente.size() * sizeof(int); }
+
+    double getSegundosConstruccion() const { return segundosConstruccion; }
+};
+
+#endif //CLAUSURATRANSITIVA_H
+#include "ClausuraTransitiva.tpp"
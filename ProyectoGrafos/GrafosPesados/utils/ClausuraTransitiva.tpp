@@ -0,0 +1,69 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <utility>
+
+template<typename Grafo>
+ClausuraTransitiva::ClausuraTransitiva(const Grafo &grafo, int hilos) {
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoComponentes fuertes = componentesFuertementeConexas(grafo);
+    componente = std::move(fuertes.componente);
+    cantidadComponentes = fuertes.cantidad;
+    const int C = cantidadComponentes;
+    const int n = componente.size();
+
+    // Condensación en CSR. Tarjan numera en orden topológico inverso, así que
+    // todo sucesor tiene un número menor que su componente.
+    std::vector<std::pair<int, int> > arcos;
+    for (int v = 0; v < n; v++) {
+        if (componente[v] < 0) continue;
+        for (const auto &adyacente: grafo.adyacentesDe(v))
+            if (componente[adyacente.indiceVertice] != componente[v])
+                arcos.emplace_back(componente[v], componente[adyacente.indiceVertice]);
+    }
+    ordenarParalelo(arcos.begin(), arcos.end(), std::less<>(), hilos);
+    arcos.erase(std::unique(arcos.begin(), arcos.end()), arcos.end());
+    std::vector<int> desplazamientos(C + 1, 0);
+    for (const auto &arco: arcos)
+        desplazamientos[arco.first + 1]++;
+    for (int c = 0; c < C; c++)
+        desplazamientos[c + 1] += desplazamientos[c];
+
+    std::vector<int> nivel(C, 0);
+    int niveles = C > 0 ? 1 : 0;
+    for (int c = 0; c < C; c++) {
+        for (int i = desplazamientos[c]; i < desplazamientos[c + 1]; i++)
+            nivel[c] = std::max(nivel[c], nivel[arcos[i].second] + 1);
+        niveles = std::max(niveles, nivel[c] + 1);
+    }
+    std::vector<std::vector<int> > porNivel(niveles);
+    for (int c = 0; c < C; c++)
+        porNivel[nivel[c]].push_back(c);
+
+    palabrasPorFila = (static_cast<size_t>(C) + 63) / 64;
+    filas.assign(palabrasPorFila * C, 0);
+    for (const auto &componentes: porNivel) {
+        paraCadaIndice(componentes.size(), hilos, [&](size_t i, int) {
+            int c = componentes[i];
+            uint64_t *propia = fila(c);
+            propia[c >> 6] |= uint64_t(1) << (c & 63);
+            // Los sucesores tienen número menor: sólo importan las palabras hasta c.
+            const size_t palabras = (static_cast<size_t>(c) >> 6) + 1;
+            for (int j = desplazamientos[c]; j < desplazamientos[c + 1]; j++) {
+                const uint64_t *sucesora = fila(arcos[j].second);
+                for (size_t w = 0; w < palabras; w++)
+                    propia[w] |= sucesora[w];
+            }
+        }, 16);
+    }
+    segundosConstruccion = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+inline std::vector<int> ClausuraTransitiva::alcanzablesDesde(int nroOrigen) const {
+    std::vector<int> resultado;
+    for (int v = 0; v < static_cast<int>(componente.size()); v++)
+        if (alcanza(nroOrigen, v))
+            resultado.push_back(v);
+    return resultado;
+}
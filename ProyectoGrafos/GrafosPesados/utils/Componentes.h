@@ -0,0 +1,33 @@
+#ifndef COMPONENTES_H
+#define COMPONENTES_H
+#include <vector>
+
+#include "UnionFind.h"
+
+struct ResultadoComponentes {
+    // Componente de cada vértice; -1 para las lápidas del modo de ids estables.
+    std::vector<int> componente;
+    int cantidad = 0;
+
+    std::vector<int> tamanos() const {
+        std::vector<int> resultado(cantidad, 0);
+        for (int c: componente)
+            if (c >= 0) resultado[c]++;
+        return resultado;
+    }
+};
+
+// Componentes conexas con UnionFind sobre los arcos; en un grafo dirigido son las
+// componentes débiles. Sirve para GrafoPesado y GrafoCompacto.
+template<typename Grafo>
+ResultadoComponentes componentesConexas(const Grafo &grafo);
+
+// Componentes fuertemente conexas con Tarjan iterativo (pila explícita, sin recursión),
+// apto para grafos de millones de vértices. Las componentes quedan numeradas en orden
+// topológico inverso de la condensación: todo arco entre componentes va de una
+// componente de número mayor a una de número menor.
+template<typename Grafo>
+ResultadoComponentes componentesFuertementeConexas(const Grafo &grafo);
+
+#endif //COMPONENTES_H
+#include "Componentes.tpp"
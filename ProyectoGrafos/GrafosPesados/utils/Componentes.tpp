@@ -0,0 +1,91 @@
+#pragma once
+#include <algorithm>
+#include <utility>
+
+template<typename Grafo>
+bool esVerticeActivo(const Grafo &grafo, int vertice) {
+    if constexpr (requires { grafo.estaEliminado(vertice); })
+        return !grafo.estaEliminado(vertice);
+    else
+        return true;
+}
+
+template<typename Grafo>
+ResultadoComponentes componentesConexas(const Grafo &grafo) {
+    const int n = grafo.cantidadVertices();
+    UnionFind conjuntos(n);
+    for (int v = 0; v < n; v++)
+        for (const auto &adyacente: grafo.adyacentesDe(v))
+            conjuntos.unir(v, adyacente.indiceVertice);
+
+    ResultadoComponentes resultado;
+    resultado.componente.assign(n, -1);
+    std::vector<int> numeroDeRaiz(n, -1);
+    for (int v = 0; v < n; v++) {
+        if (!esVerticeActivo(grafo, v)) continue;
+        int raiz = conjuntos.buscar(v);
+        if (numeroDeRaiz[raiz] < 0)
+            numeroDeRaiz[raiz] = resultado.cantidad++;
+        resultado.componente[v] = numeroDeRaiz[raiz];
+    }
+    return resultado;
+}
+
+template<typename Grafo>
+ResultadoComponentes componentesFuertementeConexas(const Grafo &grafo) {
+    const int n = grafo.cantidadVertices();
+    const int SIN_VISITAR = -1;
+    std::vector<int> indice(n, SIN_VISITAR);
+    std::vector<int> bajo(n);
+    std::vector<bool> enPila(n, false);
+    std::vector<int> pila;
+    // Marco de la recursión simulada: vértice y próximo arco a explorar.
+    std::vector<std::pair<int, int> > llamadas;
+
+    ResultadoComponentes resultado;
+    resultado.componente.assign(n, -1);
+    int contador = 0;
+
+    auto visitar = [&](int vertice) {
+        indice[vertice] = bajo[vertice] = contador++;
+        pila.push_back(vertice);
+        enPila[vertice] = true;
+        llamadas.emplace_back(vertice, 0);
+    };
+
+    for (int raiz = 0; raiz < n; raiz++) {
+        if (indice[raiz] != SIN_VISITAR || !esVerticeActivo(grafo, raiz)) continue;
+        visitar(raiz);
+
+        while (!llamadas.empty()) {
+            auto &[vertice, siguiente] = llamadas.back();
+            auto adyacentes = grafo.adyacentesDe(vertice);
+            if (siguiente < static_cast<int>(adyacentes.size())) {
+                int vecino = adyacentes[siguiente++].indiceVertice;
+                if (indice[vecino] == SIN_VISITAR)
+                    visitar(vecino);
+                else if (enPila[vecino])
+                    bajo[vertice] = std::min(bajo[vertice], indice[vecino]);
+                continue;
+            }
+
+            int terminado = vertice;
+            llamadas.pop_back();
+            if (bajo[terminado] == indice[terminado]) {
+                int miembro;
+                do {
+                    miembro = pila.back();
+                    pila.pop_back();
+                    enPila[miembro] = false;
+                    resultado.componente[miembro] = resultado.cantidad;
+                } while (miembro != terminado);
+                resultado.cantidad++;
+            }
+            if (!llamadas.empty()) {
+                int padre = llamadas.back().first;
+                bajo[padre] = std::min(bajo[padre], bajo[terminado]);
+            }
+        }
+    }
+    return resultado;
+}
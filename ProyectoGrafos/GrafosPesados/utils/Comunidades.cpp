@@ -0,0 +1,231 @@
+#include "Comunidades.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <utility>
+
+// Grado ponderado de cada nodo; un lazo cuenta dos veces, como en la matriz de adyacencia.
+static std::vector<double> calcularGrados(const RedAfinidad &red) {
+    std::vector<double> grados(red.cantidadNodos());
+    for (int v = 0; v < red.cantidadNodos(); v++) {
+        grados[v] = 2 * red.propios[v];
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++)
+            grados[v] += red.pesos[a];
+    }
+    return grados;
+}
+
+static double calcularModularidad(const RedAfinidad &red, const std::vector<int> &comunidad,
+                                  const std::vector<double> &grados, double total, double resolucion) {
+    if (total <= 0)
+        return 0;
+    int n = red.cantidadNodos();
+    std::vector<double> internos(n, 0), totales(n, 0);
+    for (int v = 0; v < n; v++) {
+        totales[comunidad[v]] += grados[v];
+        internos[comunidad[v]] += 2 * red.propios[v];
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++)
+            if (comunidad[red.vecinos[a]] == comunidad[v]) internos[comunidad[v]] += red.pesos[a];
+    }
+    double modularidad = 0;
+    for (int c = 0; c < n; c++)
+        modularidad += internos[c] / total - resolucion * (totales[c] / total) * (totales[c] / total);
+    return modularidad;
+}
+
+// Pasadas de movimientos locales hasta que la modularidad deja de subir. Devuelve true
+// si algún nodo cambió de comunidad.
+static bool moverNodos(const RedAfinidad &red, std::vector<int> &comunidad, int hilos, double resolucion) {
+    const int n = red.cantidadNodos();
+    const int LOTE = 1 << 14;
+    const int MAXIMO_PASADAS = 64;
+    const double MEJORA_MINIMA = 1e-7;
+
+    std::vector<double> grados = calcularGrados(red);
+    double total = std::accumulate(grados.begin(), grados.end(), 0.0);
+    if (total <= 0)
+        return false;
+    std::vector<double> totales(grados);
+    std::vector<int> tamanos(n, 1);
+
+    hilos = std::max(1, hilos);
+    std::vector<std::vector<double> > pesoHacia(hilos);
+    std::vector<std::vector<int> > tocadas(hilos);
+    std::vector<int> destinos(std::min(n, LOTE));
+
+    auto mejorComunidad = [&](int v, int idHilo) {
+        auto &peso = pesoHacia[idHilo];
+        auto &vistas = tocadas[idHilo];
+        if (peso.empty()) peso.assign(n, 0);
+        int actual = comunidad[v];
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+            int c = comunidad[red.vecinos[a]];
+            if (peso[c] == 0) vistas.push_back(c);
+            peso[c] += red.pesos[a];
+        }
+
+        // Ganancia de unirse a c, sin los términos que no dependen de c.
+        double k = grados[v];
+        double quedarse = peso[actual] - resolucion * k * (totales[actual] - k) / total;
+        int mejor = actual;
+        double mejorGanancia = quedarse;
+        for (int c: vistas) {
+            if (c == actual || peso[c] == 0) continue;
+            if (tamanos[actual] == 1 && tamanos[c] == 1 && c > actual) continue;
+            double ganancia = peso[c] - resolucion * k * totales[c] / total;
+            if (ganancia > mejorGanancia || (ganancia == mejorGanancia && mejor != actual && c < mejor)) {
+                mejorGanancia = ganancia;
+                mejor = c;
+            }
+        }
+        for (int c: vistas)
+            peso[c] = 0;
+        peso[actual] = 0;
+        vistas.clear();
+        return mejor;
+    };
+
+    // Las decisiones del lote se tomaron sobre la asignación previa; al aplicarlas en
+    // orden se descartan las que movimientos anteriores del mismo lote volvieron inútiles.
+    auto sigueConviniendo = [&](int v, int destino) {
+        int actual = comunidad[v];
+        double haciaActual = 0, haciaDestino = 0;
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+            int c = comunidad[red.vecinos[a]];
+            if (c == actual) haciaActual += red.pesos[a];
+            else if (c == destino) haciaDestino += red.pesos[a];
+        }
+        double k = grados[v];
+        return haciaDestino - resolucion * k * totales[destino] / total >
+               haciaActual - resolucion * k * (totales[actual] - k) / total;
+    };
+
+    bool huboMovimientos = false;
+    double modularidad = calcularModularidad(red, comunidad, grados, total, resolucion);
+    for (int pasada = 0; pasada < MAXIMO_PASADAS; pasada++) {
+        int movidos = 0;
+        for (int inicio = 0; inicio < n; inicio += LOTE) {
+            int fin = std::min(n, inicio + LOTE);
+            paraCadaIndice(fin - inicio, hilos, [&](size_t i, int idHilo) {
+                destinos[i] = mejorComunidad(inicio + i, idHilo);
+            }, 256);
+            for (int v = inicio; v < fin; v++) {
+                int destino = destinos[v - inicio];
+                if (destino == comunidad[v] || !sigueConviniendo(v, destino)) continue;
+                totales[comunidad[v]] -= grados[v];
+                tamanos[comunidad[v]]--;
+                totales[destino] += grados[v];
+                tamanos[destino]++;
+                comunidad[v] = destino;
+                movidos++;
+            }
+        }
+        if (movidos == 0)
+            break;
+        huboMovimientos = true;
+        double nueva = calcularModularidad(red, comunidad, grados, total, resolucion);
+        if (nueva - modularidad < MEJORA_MINIMA)
+            break;
+        modularidad = nueva;
+    }
+    return huboMovimientos;
+}
+
+RedAfinidad agregarComunidades(const RedAfinidad &red, std::vector<int> &comunidad, int hilos) {
+    const int n = red.cantidadNodos();
+    std::vector<int> numero(n, -1);
+    int cantidad = 0;
+    for (int v = 0; v < n; v++) {
+        if (numero[comunidad[v]] < 0) numero[comunidad[v]] = cantidad++;
+        comunidad[v] = numero[comunidad[v]];
+    }
+
+    std::vector<int> inicioMiembros(cantidad + 1, 0);
+    for (int v = 0; v < n; v++)
+        inicioMiembros[comunidad[v] + 1]++;
+    for (int c = 0; c < cantidad; c++)
+        inicioMiembros[c + 1] += inicioMiembros[c];
+    std::vector<int> miembros(n);
+    std::vector<int> posiciones(inicioMiembros.begin(), inicioMiembros.end() - 1);
+    for (int v = 0; v < n; v++)
+        miembros[posiciones[comunidad[v]]++] = v;
+
+    RedAfinidad agregada;
+    agregada.propios.assign(cantidad, 0);
+    std::vector<std::vector<std::pair<int, double> > > aristas(cantidad);
+    hilos = std::max(1, hilos);
+    std::vector<std::vector<double> > pesoHacia(hilos);
+    std::vector<std::vector<int> > tocadas(hilos);
+    paraCadaIndice(cantidad, hilos, [&](size_t c, int idHilo) {
+        auto &peso = pesoHacia[idHilo];
+        auto &vistas = tocadas[idHilo];
+        if (peso.empty()) peso.assign(cantidad, 0);
+        double internos = 0;
+        for (int i = inicioMiembros[c]; i < inicioMiembros[c + 1]; i++) {
+            int v = miembros[i];
+            agregada.propios[c] += red.propios[v];
+            for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+                int otra = comunidad[red.vecinos[a]];
+                if (otra == static_cast<int>(c)) {
+                    internos += red.pesos[a];
+                } else {
+                    if (peso[otra] == 0) vistas.push_back(otra);
+                    peso[otra] += red.pesos[a];
+                }
+            }
+        }
+        // Cada arista interna se vio desde sus dos extremos.
+        agregada.propios[c] += internos / 2;
+        std::sort(vistas.begin(), vistas.end());
+        vistas.erase(std::unique(vistas.begin(), vistas.end()), vistas.end());
+        for (int otra: vistas) {
+            aristas[c].emplace_back(otra, peso[otra]);
+            peso[otra] = 0;
+        }
+        vistas.clear();
+    }, 64);
+
+    agregada.desplazamientos.assign(cantidad + 1, 0);
+    for (int c = 0; c < cantidad; c++)
+        agregada.desplazamientos[c + 1] = agregada.desplazamientos[c] + aristas[c].size();
+    agregada.vecinos.resize(agregada.desplazamientos.back());
+    agregada.pesos.resize(agregada.desplazamientos.back());
+    for (int c = 0; c < cantidad; c++) {
+        int posicion = agregada.desplazamientos[c];
+        for (const auto &[otra, peso]: aristas[c]) {
+            agregada.vecinos[posicion] = otra;
+            agregada.pesos[posicion++] = peso;
+        }
+    }
+    return agregada;
+}
+
+ResultadoComunidades louvain(RedAfinidad red, int hilos, double resolucion) {
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoComunidades resultado;
+    // Nodo de la red actual al que pertenece cada nodo de la red original.
+    std::vector<int> asignacion(red.cantidadNodos());
+    std::iota(asignacion.begin(), asignacion.end(), 0);
+
+    while (true) {
+        std::vector<int> comunidad(red.cantidadNodos());
+        std::iota(comunidad.begin(), comunidad.end(), 0);
+        if (!moverNodos(red, comunidad, hilos, resolucion))
+            break;
+        resultado.niveles++;
+        red = agregarComunidades(red, comunidad, hilos);
+        for (int &nodo: asignacion)
+            nodo = comunidad[nodo];
+    }
+
+    std::vector<int> identidad(red.cantidadNodos());
+    std::iota(identidad.begin(), identidad.end(), 0);
+    std::vector<double> grados = calcularGrados(red);
+    resultado.modularidad = calcularModularidad(red, identidad, grados,
+                                                std::accumulate(grados.begin(), grados.end(), 0.0), resolucion);
+    resultado.comunidad = std::move(asignacion);
+    resultado.cantidad = red.cantidadNodos();
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
@@ -0,0 +1,81 @@
+#ifndef COMUNIDADES_H
+#define COMUNIDADES_H
+#include <vector>
+
+#include "Componentes.h"
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+
+// Afinidad de una ruta para la modularidad: cuanto más corta, más fuerte el vínculo.
+// Las rutas de costo no positivo no aportan.
+template<typename Politica = PesoDistancia>
+struct AfinidadInversa {
+    Politica peso;
+
+    double operator()(const AdyacenteConPeso &arco) const {
+        double costo = peso(arco);
+        return costo > 0 ? 1.0 / costo : 0;
+    }
+};
+
+struct AfinidadUnitaria {
+    double operator()(const AdyacenteConPeso &arco) const {
+        return 1;
+    }
+};
+
+struct ResultadoComunidades {
+    // Comunidad de cada vértice; -1 para las lápidas del modo de ids estables. Las
+    // comunidades quedan numeradas por su vértice de menor índice.
+    std::vector<int> comunidad;
+    int cantidad = 0;
+    double modularidad = 0;
+    // Niveles de agregación en los que algún vértice cambió de comunidad.
+    int niveles = 0;
+    double segundos = 0;
+
+    std::vector<int> tamanos() const {
+        std::vector<int> resultado(cantidad, 0);
+        for (int c: comunidad)
+            if (c >= 0) resultado[c]++;
+        return resultado;
+    }
+};
+
+// Red no dirigida de afinidades en CSR. 'propios' guarda el peso de los lazos, que
+// aparecen al agregar una comunidad en un solo nodo.
+struct RedAfinidad {
+    std::vector<int> desplazamientos;
+    std::vector<int> vecinos;
+    std::vector<double> pesos;
+    std::vector<double> propios;
+
+    int cantidadNodos() const { return propios.size(); }
+};
+
+// Red de afinidades sobre los vértices activos. 'nodo' queda con el nodo de cada vértice
+// (-1 para las lápidas); en grafos dirigidos los dos sentidos de una ruta se suman.
+template<typename Grafo, typename Afinidad>
+RedAfinidad construirRedAfinidad(const Grafo &grafo, Afinidad afinidad, std::vector<int> &nodo,
+                                 int hilos = cantidadHilos());
+
+// Contrae cada comunidad en un nodo y renumera 'comunidad' por orden de aparición. Las
+// aristas entre comunidades se suman y el peso interno pasa a los lazos.
+RedAfinidad agregarComunidades(const RedAfinidad &red, std::vector<int> &comunidad, int hilos = cantidadHilos());
+
+// Louvain sobre una red ya armada. En cada pasada los vértices eligen su mejor comunidad
+// por lotes: dentro de un lote las decisiones se toman en paralelo sobre la asignación
+// previa y se aplican en orden al terminar, descartando las que dejaron de mejorar; así
+// el resultado no depende de los hilos. Un vértice solo no pasa a otra comunidad de un
+// solo vértice con número mayor, lo que evita intercambios indefinidos. Cuando las pasadas
+// dejan de mejorar la modularidad, cada comunidad se agrega en un nodo (CSR nuevo con
+// las aristas entre comunidades sumadas) y se repite sobre la red agregada.
+ResultadoComunidades louvain(RedAfinidad red, int hilos = cantidadHilos(), double resolucion = 1);
+
+// Comunidades del grafo por modularidad. 'resolucion' > 1 da comunidades más chicas.
+template<typename Grafo, typename Afinidad = AfinidadInversa<> >
+ResultadoComunidades detectarComunidades(const Grafo &grafo, Afinidad afinidad = Afinidad(),
+                                         int hilos = cantidadHilos(), double resolucion = 1);
+
+#endif //COMUNIDADES_H
+#include "Comunidades.tpp"
@@ -0,0 +1,80 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+
+template<typename Grafo, typename Afinidad>
+RedAfinidad construirRedAfinidad(const Grafo &grafo, Afinidad afinidad, std::vector<int> &nodo, int hilos) {
+    const int n = grafo.cantidadVertices();
+    nodo.assign(n, -1);
+    int activos = 0;
+    for (int v = 0; v < n; v++)
+        if (esVerticeActivo(grafo, v)) nodo[v] = activos++;
+
+    struct Enlace {
+        int a;
+        int b;
+        double peso;
+    };
+    RedAfinidad red;
+    red.propios.assign(activos, 0);
+    std::vector<Enlace> enlaces;
+    for (int v = 0; v < n; v++) {
+        if (nodo[v] < 0) continue;
+        for (const auto &adyacente: grafo.adyacentesDe(v)) {
+            int w = adyacente.indiceVertice;
+            double peso = afinidad(adyacente);
+            if (nodo[w] < 0 || peso <= 0 || (!grafo.esDirigido() && w < v)) continue;
+            if (w == v)
+                red.propios[nodo[v]] += peso;
+            else
+                enlaces.push_back({std::min(nodo[v], nodo[w]), std::max(nodo[v], nodo[w]), peso});
+        }
+    }
+    ordenarParalelo(enlaces.begin(), enlaces.end(), [](const Enlace &x, const Enlace &y) {
+        return x.a != y.a ? x.a < y.a : x.b < y.b;
+    }, hilos);
+
+    // Las rutas repetidas (o de ida y vuelta) se suman en una sola arista.
+    size_t escritura = 0;
+    for (size_t i = 0; i < enlaces.size(); i++) {
+        if (escritura > 0 && enlaces[escritura - 1].a == enlaces[i].a && enlaces[escritura - 1].b == enlaces[i].b)
+            enlaces[escritura - 1].peso += enlaces[i].peso;
+        else
+            enlaces[escritura++] = enlaces[i];
+    }
+    enlaces.resize(escritura);
+
+    red.desplazamientos.assign(activos + 1, 0);
+    for (const auto &enlace: enlaces) {
+        red.desplazamientos[enlace.a + 1]++;
+        red.desplazamientos[enlace.b + 1]++;
+    }
+    for (int v = 0; v < activos; v++)
+        red.desplazamientos[v + 1] += red.desplazamientos[v];
+    red.vecinos.resize(red.desplazamientos.back());
+    red.pesos.resize(red.desplazamientos.back());
+    std::vector<int> posiciones(red.desplazamientos.begin(), red.desplazamientos.end() - 1);
+    for (const auto &enlace: enlaces) {
+        red.vecinos[posiciones[enlace.a]] = enlace.b;
+        red.pesos[posiciones[enlace.a]++] = enlace.peso;
+        red.vecinos[posiciones[enlace.b]] = enlace.a;
+        red.pesos[posiciones[enlace.b]++] = enlace.peso;
+    }
+    return red;
+}
+
+template<typename Grafo, typename Afinidad>
+ResultadoComunidades detectarComunidades(const Grafo &grafo, Afinidad afinidad, int hilos, double resolucion) {
+    auto inicio = std::chrono::steady_clock::now();
+    const int n = grafo.cantidadVertices();
+    std::vector<int> nodo;
+    RedAfinidad red = construirRedAfinidad(grafo, afinidad, nodo, hilos);
+
+    ResultadoComunidades resultado = louvain(std::move(red), hilos, resolucion);
+    std::vector<int> porNodo = std::move(resultado.comunidad);
+    resultado.comunidad.assign(n, -1);
+    for (int v = 0; v < n; v++)
+        if (nodo[v] >= 0) resultado.comunidad[v] = porNodo[nodo[v]];
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
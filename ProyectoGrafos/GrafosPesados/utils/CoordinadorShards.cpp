@@ -0,0 +1,545 @@
+#include "CoordinadorShards.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <unordered_map>
+
+// Mensaje: tipo (u32) | bytes de la carga (u32) | carga
+static bool escribirTodo(int socket, const void *datos, size_t bytes) {
+    const char *posicion = static_cast<const char *>(datos);
+    while (bytes > 0) {
+        ssize_t escritos = send(socket, posicion, bytes, MSG_NOSIGNAL);
+        if (escritos < 0 && errno == EINTR) continue;
+        if (escritos <= 0) return false;
+        posicion += escritos;
+        bytes -= escritos;
+    }
+    return true;
+}
+
+static bool leerTodo(int socket, void *datos, size_t bytes) {
+    char *posicion = static_cast<char *>(datos);
+    while (bytes > 0) {
+        ssize_t leidos = recv(socket, posicion, bytes, 0);
+        if (leidos < 0 && errno == EINTR) continue;
+        if (leidos <= 0) return false;
+        posicion += leidos;
+        bytes -= leidos;
+    }
+    return true;
+}
+
+static bool enviarMensaje(int socket, uint32_t tipo, const std::vector<char> &carga) {
+    uint32_t encabezado[2] = {tipo, static_cast<uint32_t>(carga.size())};
+    return escribirTodo(socket, encabezado, sizeof(encabezado)) && escribirTodo(socket, carga.data(), carga.size());
+}
+
+static bool recibirMensaje(int socket, uint32_t &tipo, std::vector<char> &carga) {
+    uint32_t encabezado[2];
+    if (!leerTodo(socket, encabezado, sizeof(encabezado)))
+        return false;
+    tipo = encabezado[0];
+    carga.resize(encabezado[1]);
+    return leerTodo(socket, carga.data(), carga.size());
+}
+
+template<typename V>
+static void agregar(std::vector<char> &carga, const V &valor) {
+    const char *bytes = reinterpret_cast<const char *>(&valor);
+    carga.insert(carga.end(), bytes, bytes + sizeof(V));
+}
+
+template<typename V>
+static V extraer(const std::vector<char> &carga, size_t &posicion) {
+    if (posicion + sizeof(V) > carga.size())
+        throw std::invalid_argument("Mensaje de shard truncado");
+    V valor;
+    std::memcpy(&valor, carga.data() + posicion, sizeof(V));
+    posicion += sizeof(V);
+    return valor;
+}
+
+static std::vector<int> extraerLista(const std::vector<char> &carga, size_t &posicion) {
+    std::vector<int> lista(extraer<int32_t>(carga, posicion));
+    for (int &valor: lista)
+        valor = extraer<int32_t>(carga, posicion);
+    return lista;
+}
+
+static int64_t leerBytesPrivados() {
+    std::ifstream archivo("/proc/self/smaps_rollup");
+    std::string linea;
+    int64_t total = 0;
+    while (std::getline(archivo, linea)) {
+        if (linea.rfind("Private_", 0) != 0) continue;
+        int64_t kilobytes = 0;
+        std::istringstream(linea.substr(linea.find(':') + 1)) >> kilobytes;
+        total += kilobytes * 1024;
+    }
+    return total;
+}
+
+// Los shards se lanzan como: /proc/self/exe --shard <socket> <archivo del shard>
+static constexpr const char *EJECUTABLE_PROPIO = "/proc/self/exe";
+static constexpr const char *ARGUMENTO_SHARD = "--shard";
+
+// Archivo de un shard: dirigido (u8) y, por cada arreglo, su tamaño (u64) y sus elementos.
+template<typename V>
+static void escribirArreglo(std::ofstream &archivo, const std::vector<V> &arreglo) {
+    uint64_t cantidad = arreglo.size();
+    archivo.write(reinterpret_cast<const char *>(&cantidad), sizeof(cantidad));
+    archivo.write(reinterpret_cast<const char *>(arreglo.data()), cantidad * sizeof(V));
+}
+
+template<typename V>
+static void leerArreglo(std::ifstream &archivo, std::vector<V> &arreglo, const V &relleno = V()) {
+    uint64_t cantidad = 0;
+    archivo.read(reinterpret_cast<char *>(&cantidad), sizeof(cantidad));
+    if (!archivo || cantidad > std::numeric_limits<int>::max())
+        throw std::runtime_error("Archivo de shard corrupto");
+    arreglo.assign(cantidad, relleno);
+    archivo.read(reinterpret_cast<char *>(arreglo.data()), cantidad * sizeof(V));
+    if (!archivo)
+        throw std::runtime_error("Archivo de shard truncado");
+}
+
+static void guardarShard(const CoordinadorShards::DatosShard &datos, bool dirigido, const std::string &ruta) {
+    std::ofstream archivo(ruta, std::ios::binary | std::ios::trunc);
+    uint8_t esDirigido = dirigido;
+    archivo.write(reinterpret_cast<const char *>(&esDirigido), sizeof(esDirigido));
+    escribirArreglo(archivo, datos.globales);
+    escribirArreglo(archivo, datos.desplazamientos);
+    escribirArreglo(archivo, datos.arcos);
+    escribirArreglo(archivo, datos.bordes);
+    archivo.close();
+    if (!archivo)
+        throw std::runtime_error("No se pudo guardar el shard: " + ruta);
+}
+
+static CoordinadorShards::DatosShard cargarShard(const std::string &ruta, bool &dirigido) {
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo)
+        throw std::runtime_error("No se pudo abrir el shard: " + ruta);
+    uint8_t esDirigido = 0;
+    archivo.read(reinterpret_cast<char *>(&esDirigido), sizeof(esDirigido));
+    CoordinadorShards::DatosShard datos;
+    leerArreglo(archivo, datos.globales);
+    leerArreglo(archivo, datos.desplazamientos);
+    leerArreglo(archivo, datos.arcos, AdyacenteConPeso(0));
+    leerArreglo(archivo, datos.bordes);
+    if (datos.desplazamientos.size() != datos.globales.size() + 1 || datos.desplazamientos.back() != static_cast<int>(datos.arcos.size()))
+        throw std::runtime_error("Archivo de shard corrupto: " + ruta);
+    dirigido = esDirigido;
+    return datos;
+}
+
+static void borrarDirectorio(std::string &directorio) {
+    if (directorio.empty()) return;
+    std::error_code error;
+    std::filesystem::remove_all(directorio, error);
+    directorio.clear();
+}
+
+// Bucle del proceso de un shard: atiende pedidos hasta TERMINAR o hasta que el
+// coordinador cierra el socket.
+static void atenderShard(int socket, CoordinadorShards::DatosShard datos, bool dirigido) {
+    const int n = datos.globales.size();
+    std::unordered_map<int, int> local;
+    local.reserve(n);
+    for (int v = 0; v < n; v++)
+        local[datos.globales[v]] = v;
+
+    EstadisticasShard estadisticas;
+    estadisticas.vertices = n;
+    estadisticas.arcos = datos.arcos.size();
+    estadisticas.bordes = datos.bordes.size();
+    GrafoCompacto<int> subgrafo(std::move(datos.globales), std::move(datos.desplazamientos),
+                                std::move(datos.arcos), dirigido);
+    GrafoCompacto<int> inverso = dirigido ? subgrafo.transpuesto() : GrafoCompacto<int>();
+    const GrafoCompacto<int> &haciaAtras = dirigido ? inverso : subgrafo;
+    estadisticas.bytesEstructura = (dirigido ? 2 : 1) * (static_cast<int64_t>(n) * 2 * sizeof(int) +
+                                                        estadisticas.arcos * sizeof(AdyacenteConPeso))
+                                   + static_cast<int64_t>(n) * (2 * sizeof(int) + sizeof(void *));
+
+    EspacioConsulta espacio;
+    std::vector<char> esObjetivo(n, 0);
+    auto aLocal = [&](int global) {
+        auto it = local.find(global);
+        if (it == local.end())
+            throw std::invalid_argument("Vertice ajeno al shard: " + std::to_string(global));
+        return it->second;
+    };
+    auto agregarDistancias = [&](const GrafoCompacto<int> &grafo, int origen, const std::vector<int> &objetivos,
+                                 std::vector<char> &respuesta) {
+        int restantes = 0;
+        for (int objetivo: objetivos) {
+            if (!esObjetivo[objetivo]) restantes++;
+            esObjetivo[objetivo] = 1;
+        }
+        if (restantes > 0)
+            buscarCaminos(grafo, origen, espacio, PesoDistancia(), ParadaEnDestinos{&esObjetivo, restantes});
+        for (int objetivo: objetivos) {
+            esObjetivo[objetivo] = 0;
+            agregar(respuesta, restantes > 0 ? espacio.getCosto(objetivo) : EspacioConsulta::INFINITO);
+        }
+    };
+
+    uint32_t tipo;
+    std::vector<char> pedido;
+    while (recibirMensaje(socket, tipo, pedido)) {
+        if (tipo == CoordinadorShards::TERMINAR)
+            return;
+        auto inicio = std::chrono::steady_clock::now();
+        std::vector<char> respuesta;
+        uint32_t tipoRespuesta = tipo;
+        try {
+            size_t posicion = 0;
+            switch (tipo) {
+                case CoordinadorShards::DISTANCIAS: {
+                    int vertice = aLocal(extraer<int32_t>(pedido, posicion));
+                    bool haciaVertice = extraer<uint8_t>(pedido, posicion);
+                    std::vector<int> objetivos = extraerLista(pedido, posicion);
+                    for (int &objetivo: objetivos)
+                        objetivo = aLocal(objetivo);
+                    agregarDistancias(haciaVertice ? haciaAtras : subgrafo, vertice, objetivos, respuesta);
+                    estadisticas.consultas++;
+                    break;
+                }
+                case CoordinadorShards::DISTANCIAS_ENTRE: {
+                    std::vector<int> vertices = extraerLista(pedido, posicion);
+                    for (int &vertice: vertices)
+                        vertice = aLocal(vertice);
+                    for (int origen: vertices)
+                        agregarDistancias(subgrafo, origen, vertices, respuesta);
+                    break;
+                }
+                case CoordinadorShards::CAMINO: {
+                    int origen = aLocal(extraer<int32_t>(pedido, posicion));
+                    int destino = aLocal(extraer<int32_t>(pedido, posicion));
+                    buscarCaminos(subgrafo, origen, espacio, PesoDistancia(), ParadaEnDestino(destino));
+                    std::vector<int> camino = espacio.reconstruirCamino(destino);
+                    agregar<int32_t>(respuesta, camino.size());
+                    for (int vertice: camino)
+                        agregar<int32_t>(respuesta, subgrafo.getVertice(vertice));
+                    estadisticas.consultas++;
+                    break;
+                }
+                case CoordinadorShards::ESTADISTICAS:
+                    estadisticas.bytesPrivados = leerBytesPrivados();
+                    agregar(respuesta, estadisticas);
+                    break;
+                default:
+                    throw std::invalid_argument("Mensaje de shard desconocido");
+            }
+        } catch (const std::exception &e) {
+            tipoRespuesta = CoordinadorShards::ERROR;
+            respuesta.assign(e.what(), e.what() + std::strlen(e.what()));
+        }
+        if (tipo == CoordinadorShards::DISTANCIAS || tipo == CoordinadorShards::CAMINO)
+            estadisticas.segundosConsultas +=
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        if (!enviarMensaje(socket, tipoRespuesta, respuesta))
+            return;
+    }
+}
+
+bool CoordinadorShards::atenderSiEsShard(int argc, char *argv[]) {
+    if (argc != 4 || std::strcmp(argv[1], ARGUMENTO_SHARD) != 0)
+        return false;
+    int socket = std::atoi(argv[2]);
+    try {
+        bool dirigido;
+        DatosShard datos = cargarShard(argv[3], dirigido);
+        std::filesystem::remove(argv[3]);
+        atenderShard(socket, std::move(datos), dirigido);
+    } catch (const std::exception &e) {
+        // El coordinador la lee como respuesta a su primer pedido.
+        enviarMensaje(socket, ERROR, std::vector<char>(e.what(), e.what() + std::strlen(e.what())));
+    }
+    close(socket);
+    return true;
+}
+
+void CoordinadorShards::enviar(int shard, TipoMensaje tipo, const std::vector<char> &carga) {
+    if (!enviarMensaje(trabajadores[shard].socket, tipo, carga)) {
+        roto = true;
+        throw std::runtime_error("Se perdio la conexion con el shard " + std::to_string(shard));
+    }
+    trabajadores[shard].pendientes++;
+}
+
+std::vector<char> CoordinadorShards::recibir(int shard) {
+    uint32_t tipo;
+    std::vector<char> carga;
+    if (!recibirMensaje(trabajadores[shard].socket, tipo, carga)) {
+        roto = true;
+        throw std::runtime_error("Se perdio la conexion con el shard " + std::to_string(shard));
+    }
+    trabajadores[shard].pendientes--;
+    if (tipo == ERROR)
+        throw std::runtime_error("Shard " + std::to_string(shard) + ": " + std::string(carga.begin(), carga.end()));
+    return carga;
+}
+
+void CoordinadorShards::enviarDistancias(int shard, int vertice, bool haciaVertice,
+                                         const std::vector<int> &objetivos) {
+    std::vector<char> carga;
+    agregar<int32_t>(carga, vertice);
+    agregar<uint8_t>(carga, haciaVertice);
+    agregar<int32_t>(carga, objetivos.size());
+    for (int objetivo: objetivos)
+        agregar<int32_t>(carga, objetivo);
+    enviar(shard, DISTANCIAS, carga);
+}
+
+std::vector<double> CoordinadorShards::recibirDistancias(int shard, size_t cantidad) {
+    std::vector<char> carga = recibir(shard);
+    std::vector<double> distancias(cantidad);
+    size_t posicion = 0;
+    for (double &distancia: distancias)
+        distancia = extraer<double>(carga, posicion);
+    return distancias;
+}
+
+void CoordinadorShards::lanzarTrabajador(const DatosShard &datos) {
+    if (directorioShards.empty()) {
+        std::string plantilla = (std::filesystem::temp_directory_path() / "shards-XXXXXX").string();
+        if (mkdtemp(plantilla.data()) == nullptr)
+            throw std::runtime_error("No se pudo crear el directorio de shards: " + std::string(std::strerror(errno)));
+        directorioShards = plantilla;
+    }
+    std::string ruta = directorioShards + "/shard-" + std::to_string(trabajadores.size());
+    guardarShard(datos, dirigido, ruta);
+
+    // Los sockets se crean con cierre en exec para que ningún shard retenga los de los
+    // demás; si no, esos shards no verían el cierre cuando termina el coordinador.
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0)
+        throw std::runtime_error("No se pudo crear el socket del shard: " + std::string(std::strerror(errno)));
+    // Entre fork y exec sólo se llaman funciones async-signal-safe (el coordinador puede
+    // tener otros hilos), así que los argumentos se arman antes.
+    std::string descriptor = std::to_string(sockets[1]);
+    char *argumentos[] = {const_cast<char *>(EJECUTABLE_PROPIO), const_cast<char *>(ARGUMENTO_SHARD),
+                          descriptor.data(), ruta.data(), nullptr};
+    pid_t proceso = fork();
+    if (proceso < 0) {
+        close(sockets[0]);
+        close(sockets[1]);
+        throw std::runtime_error("No se pudo crear el proceso del shard: " + std::string(std::strerror(errno)));
+    }
+    if (proceso == 0) {
+        fcntl(sockets[1], F_SETFD, 0);
+        execv(EJECUTABLE_PROPIO, argumentos);
+        _exit(127);
+    }
+    close(sockets[1]);
+    trabajadores.push_back({proceso, sockets[0], 0, datos.bordes});
+}
+
+void CoordinadorShards::construirOverlay(const std::vector<std::vector<std::pair<int, double> > > &arcosCorte) {
+    const int n = parte.size();
+    nodoDeBorde.assign(n, -1);
+    for (const auto &trabajador: trabajadores) {
+        primerNodo.push_back(bordeDeNodo.size());
+        for (int borde: trabajador.bordes) {
+            nodoDeBorde[borde] = bordeDeNodo.size();
+            bordeDeNodo.push_back(borde);
+        }
+    }
+
+    // Todos los shards calculan a la vez las distancias internas entre sus bordes.
+    for (int i = 0; i < cantidadShards(); i++) {
+        std::vector<char> carga;
+        agregar<int32_t>(carga, trabajadores[i].bordes.size());
+        for (int borde: trabajadores[i].bordes)
+            agregar<int32_t>(carga, borde);
+        enviar(i, DISTANCIAS_ENTRE, carga);
+    }
+    const int nodos = bordeDeNodo.size();
+    std::vector<std::vector<std::pair<int, double> > > salientes(nodos);
+    for (int i = 0; i < cantidadShards(); i++) {
+        const auto &bordes = trabajadores[i].bordes;
+        std::vector<double> distancias = recibirDistancias(i, bordes.size() * bordes.size());
+        for (size_t a = 0; a < bordes.size(); a++)
+            for (size_t b = 0; b < bordes.size(); b++)
+                if (a != b && distancias[a * bordes.size() + b] < EspacioConsulta::INFINITO)
+                    salientes[primerNodo[i] + a].emplace_back(primerNodo[i] + b, distancias[a * bordes.size() + b]);
+    }
+    for (int v = 0; v < n; v++)
+        for (const auto &[w, peso]: arcosCorte[v])
+            salientes[nodoDeBorde[v]].emplace_back(nodoDeBorde[w], peso);
+
+    desplazamientosOverlay.assign(1, 0);
+    for (const auto &arcos: salientes) {
+        for (const auto &[destino, peso]: arcos) {
+            destinosOverlay.push_back(destino);
+            pesosOverlay.push_back(peso);
+        }
+        desplazamientosOverlay.push_back(destinosOverlay.size());
+    }
+    // Cada shard borró su archivo al cargarlo y ya respondió, así que el directorio está vacío.
+    borrarDirectorio(directorioShards);
+    estadisticasCoordinador.verticesOverlay = nodos;
+    estadisticasCoordinador.arcosOverlay = destinosOverlay.size();
+    estadisticasCoordinador.bytesOverlay = (nodoDeBorde.size() + bordeDeNodo.size() + desplazamientosOverlay.size()
+                                            + destinosOverlay.size() + parte.size()) * sizeof(int)
+                                           + pesosOverlay.size() * sizeof(double);
+}
+
+void CoordinadorShards::detener() {
+    for (auto &trabajador: trabajadores) {
+        enviarMensaje(trabajador.socket, TERMINAR, {});
+        close(trabajador.socket);
+        waitpid(trabajador.proceso, nullptr, 0);
+    }
+    trabajadores.clear();
+    borrarDirectorio(directorioShards);
+}
+
+void CoordinadorShards::descartarPendientes() noexcept {
+    uint32_t tipo;
+    std::vector<char> carga;
+    for (auto &trabajador: trabajadores) {
+        for (; trabajador.pendientes > 0; trabajador.pendientes--) {
+            if (!recibirMensaje(trabajador.socket, tipo, carga)) {
+                roto = true;
+                break;
+            }
+        }
+    }
+}
+
+void CoordinadorShards::verificarSincronia() const {
+    if (roto)
+        throw std::logic_error("Se perdio la conexion con algun shard: el coordinador no admite mas consultas");
+}
+
+CoordinadorShards::~CoordinadorShards() {
+    detener();
+}
+
+ResultadoConsultaShards CoordinadorShards::consultar(int origen, int destino) {
+    verificarSincronia();
+    const int n = parte.size();
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n || parte[origen] < 0 || parte[destino] < 0)
+        throw std::invalid_argument("Vertice invalido");
+    // Un error de un shard deja en los sockets las respuestas de los pedidos ya enviados
+    // a otros (la del otro extremo, los tramos de CAMINO siguientes).
+    try {
+        return resolverConsulta(origen, destino);
+    } catch (...) {
+        descartarPendientes();
+        throw;
+    }
+}
+
+ResultadoConsultaShards CoordinadorShards::resolverConsulta(int origen, int destino) {
+    auto inicio = std::chrono::steady_clock::now();
+    ResultadoConsultaShards resultado;
+    const int a = parte[origen], b = parte[destino];
+    resultado.shardsConsultados = a == b ? 1 : 2;
+
+    // Aunque compartan shard, el camino puede salir y volver: se piden ambos tramos.
+    std::vector<int> objetivosOrigen = trabajadores[a].bordes;
+    if (a == b) objetivosOrigen.push_back(destino);
+    enviarDistancias(a, origen, false, objetivosOrigen);
+    enviarDistancias(b, destino, true, trabajadores[b].bordes);
+    std::vector<double> desdeOrigen = recibirDistancias(a, objetivosOrigen.size());
+    std::vector<double> hastaDestino = recibirDistancias(b, trabajadores[b].bordes.size());
+
+    const int nodoDestino = bordeDeNodo.size();
+    EspacioConsulta &espacio = EspacioConsulta::delHilo();
+    espacio.preparar(nodoDestino + 1);
+    auto relajar = [&](int nodo, double costo, int predecesor) {
+        if (espacio.relajar(nodo, costo, predecesor))
+            espacio.insertarEnMonticulo(costo, nodo);
+    };
+    for (size_t i = 0; i < trabajadores[a].bordes.size(); i++)
+        if (desdeOrigen[i] < EspacioConsulta::INFINITO)
+            relajar(primerNodo[a] + i, desdeOrigen[i], EspacioConsulta::SIN_PREDECESOR);
+    if (a == b && desdeOrigen.back() < EspacioConsulta::INFINITO)
+        relajar(nodoDestino, desdeOrigen.back(), EspacioConsulta::SIN_PREDECESOR);
+
+    while (!espacio.monticuloVacio()) {
+        auto [costo, nodo] = espacio.extraerMinimo();
+        if (espacio.estaCerrado(nodo)) continue;
+        espacio.cerrar(nodo);
+        if (nodo == nodoDestino) break;
+        for (int arco = desplazamientosOverlay[nodo]; arco < desplazamientosOverlay[nodo + 1]; arco++)
+            if (!espacio.estaCerrado(destinosOverlay[arco]))
+                relajar(destinosOverlay[arco], costo + pesosOverlay[arco], nodo);
+        int posicion = nodo - primerNodo[b];
+        if (posicion >= 0 && posicion < static_cast<int>(hastaDestino.size()) &&
+            hastaDestino[posicion] < EspacioConsulta::INFINITO)
+            relajar(nodoDestino, costo + hastaDestino[posicion], nodo);
+    }
+
+    if (espacio.fueAlcanzado(nodoDestino)) {
+        resultado.costo = espacio.getCosto(nodoDestino);
+        std::vector<int> escalas = {origen};
+        for (int nodo: espacio.reconstruirCamino(nodoDestino)) {
+            int vertice = nodo == nodoDestino ? destino : bordeDeNodo[nodo];
+            if (vertice != escalas.back()) escalas.push_back(vertice);
+        }
+
+        // Los tramos dentro de un shard se expanden en ese shard; los demás son arcos de corte.
+        std::vector<int> tramosInternos;
+        for (size_t i = 0; i + 1 < escalas.size(); i++) {
+            if (parte[escalas[i]] != parte[escalas[i + 1]]) continue;
+            std::vector<char> carga;
+            agregar<int32_t>(carga, escalas[i]);
+            agregar<int32_t>(carga, escalas[i + 1]);
+            enviar(parte[escalas[i]], CAMINO, carga);
+            tramosInternos.push_back(i);
+        }
+        resultado.camino.push_back(origen);
+        size_t siguienteInterno = 0;
+        for (size_t i = 0; i + 1 < escalas.size(); i++) {
+            if (siguienteInterno < tramosInternos.size() && tramosInternos[siguienteInterno] == static_cast<int>(i)) {
+                siguienteInterno++;
+                std::vector<char> carga = recibir(parte[escalas[i]]);
+                size_t posicion = 0;
+                std::vector<int> tramo = extraerLista(carga, posicion);
+                resultado.camino.insert(resultado.camino.end(), tramo.begin() + 1, tramo.end());
+            } else {
+                resultado.camino.push_back(escalas[i + 1]);
+            }
+        }
+    }
+
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    estadisticasCoordinador.consultas++;
+    estadisticasCoordinador.segundosConsultas += resultado.segundos;
+    estadisticasCoordinador.segundosMaximo = std::max(estadisticasCoordinador.segundosMaximo, resultado.segundos);
+    return resultado;
+}
+
+std::vector<EstadisticasShard> CoordinadorShards::estadisticasShards() {
+    verificarSincronia();
+    try {
+        for (int i = 0; i < cantidadShards(); i++)
+            enviar(i, ESTADISTICAS, {});
+        std::vector<EstadisticasShard> estadisticas(cantidadShards());
+        for (int i = 0; i < cantidadShards(); i++) {
+            std::vector<char> carga = recibir(i);
+            size_t posicion = 0;
+            estadisticas[i] = extraer<EstadisticasShard>(carga, posicion);
+        }
+        return estadisticas;
+    } catch (...) {
+        descartarPendientes();
+        throw;
+    }
+}
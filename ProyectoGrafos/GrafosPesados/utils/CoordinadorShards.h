@@ -0,0 +1,154 @@
+#ifndef COORDINADORSHARDS_H
+#define COORDINADORSHARDS_H
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+#include "Particion.h"
+#include "../BusquedaCaminos.h"
+#include "../GrafoCompacto.h"
+
+struct EstadisticasShard {
+    int64_t vertices = 0;
+    int64_t arcos = 0;
+    int64_t bordes = 0;
+    // Memoria de las estructuras del shard (subgrafo, transpuesto e índices).
+    int64_t bytesEstructura = 0;
+    // Páginas privadas del proceso según /proc/self/smaps_rollup; 0 si no está disponible.
+    int64_t bytesPrivados = 0;
+    int64_t consultas = 0;
+    double segundosConsultas = 0;
+};
+
+struct EstadisticasCoordinador {
+    int64_t consultas = 0;
+    double segundosConsultas = 0;
+    double segundosMaximo = 0;
+    int64_t verticesOverlay = 0;
+    int64_t arcosOverlay = 0;
+    int64_t bytesOverlay = 0;
+    double segundosConstruccion = 0;
+
+    double latenciaPromedio() const { return consultas > 0 ? segundosConsultas / consultas : 0; }
+};
+
+struct ResultadoConsultaShards {
+    // Costo del camino mínimo; EspacioConsulta::INFINITO si no hay camino.
+    double costo = EspacioConsulta::INFINITO;
+    // Vértices del grafo original, origen y destino incluidos.
+    std::vector<int> camino;
+    int shardsConsultados = 0;
+    double segundos = 0;
+
+    bool existeCamino() const { return !camino.empty(); }
+};
+
+// Cada parte de una partición vive en su propio proceso, unido al coordinador por un
+// socket Unix. El coordinador arma las partes de a una, guarda cada una en un archivo
+// temporal y lanza el proceso con fork + exec del mismo ejecutable: cada shard carga
+// sólo su archivo y no hereda la memoria del coordinador ni sus hilos. Por eso main
+// debe llamar a atenderSiEsShard antes de cualquier otra cosa. El coordinador sólo
+// guarda el overlay de bordes:
+// los vértices con alguna ruta hacia otra parte, los arcos de corte y, por cada parte,
+// la distancia interna entre todos sus bordes (calculada por el shard al iniciar).
+// Un camino mínimo entre partes distintas pasa de parte en parte por bordes, así que
+// una consulta pide al shard del origen las distancias hasta sus bordes y al del
+// destino las de sus bordes hasta el destino (en paralelo), corre Dijkstra sobre el
+// overlay y expande cada tramo interno pidiéndoselo a su shard.
+// Si una consulta falla a mitad de camino se descartan las respuestas pendientes para
+// no desfasar el protocolo; si eso tampoco es posible el coordinador queda inutilizado.
+class CoordinadorShards {
+public:
+    enum TipoMensaje : uint32_t {
+        DISTANCIAS = 1,
+        DISTANCIAS_ENTRE = 2,
+        CAMINO = 3,
+        ESTADISTICAS = 4,
+        TERMINAR = 5,
+        ERROR = 6
+    };
+
+    // Subgrafo de una parte con índices locales; 'globales' da el vértice original.
+    struct DatosShard {
+        std::vector<int> globales;
+        std::vector<int> desplazamientos;
+        std::vector<AdyacenteConPeso> arcos;
+        std::vector<int> bordes;
+    };
+
+private:
+    struct Trabajador {
+        pid_t proceso;
+        int socket;
+        // Pedidos enviados cuya respuesta todavía no se leyó.
+        int pendientes;
+        std::vector<int> bordes;
+    };
+
+    bool dirigido;
+    bool roto;
+    std::string directorioShards;
+    std::vector<int> parte;
+    std::vector<Trabajador> trabajadores;
+    // Overlay: un nodo por vértice de borde; en las consultas el nodo extra bordeDeNodo.size() es el destino.
+    std::vector<int> nodoDeBorde;
+    std::vector<int> bordeDeNodo;
+    // Los bordes de cada shard ocupan nodos consecutivos a partir de este.
+    std::vector<int> primerNodo;
+    std::vector<int> desplazamientosOverlay;
+    std::vector<int> destinosOverlay;
+    std::vector<double> pesosOverlay;
+    EstadisticasCoordinador estadisticasCoordinador;
+
+    // Guarda el shard en un archivo temporal y lanza el proceso que lo carga.
+    void lanzarTrabajador(const DatosShard &datos);
+
+    void construirOverlay(const std::vector<std::vector<std::pair<int, double> > > &arcosCorte);
+
+    // Pide terminar a los shards y espera sus procesos.
+    void detener();
+
+    void enviar(int shard, TipoMensaje tipo, const std::vector<char> &carga);
+
+    std::vector<char> recibir(int shard);
+
+    // Lee y descarta las respuestas pendientes; si un shard no responde marca el coordinador como roto.
+    void descartarPendientes() noexcept;
+
+    void verificarSincronia() const;
+
+    ResultadoConsultaShards resolverConsulta(int origen, int destino);
+
+    void enviarDistancias(int shard, int vertice, bool haciaVertice, const std::vector<int> &objetivos);
+
+    std::vector<double> recibirDistancias(int shard, size_t cantidad);
+
+public:
+    // Punto de entrada de los procesos shard: si argv corresponde a uno, atiende al
+    // coordinador y devuelve true cuando termina; si no, devuelve false sin hacer nada.
+    static bool atenderSiEsShard(int argc, char *argv[]);
+
+    // Todos los vértices activos deben tener parte; peso(arco) fija el costo que usan los shards.
+    template<typename Grafo, typename Politica = PesoDistancia>
+    CoordinadorShards(const Grafo &grafo, const ResultadoParticion &particion, Politica peso = Politica());
+
+    ~CoordinadorShards();
+
+    CoordinadorShards(const CoordinadorShards &) = delete;
+
+    CoordinadorShards &operator=(const CoordinadorShards &) = delete;
+
+    ResultadoConsultaShards consultar(int origen, int destino);
+
+    int cantidadShards() const { return trabajadores.size(); }
+
+    int getParte(int vertice) const { return parte[vertice]; }
+
+    std::vector<EstadisticasShard> estadisticasShards();
+
+    const EstadisticasCoordinador &getEstadisticas() const { return estadisticasCoordinador; }
+};
+
+#endif //COORDINADORSHARDS_H
+#include "CoordinadorShards.tpp"
@@ -0,0 +1,60 @@
+#pragma once
+#include <chrono>
+#include <stdexcept>
+
+template<typename Grafo, typename Politica>
+CoordinadorShards::CoordinadorShards(const Grafo &grafo, const ResultadoParticion &particion, Politica peso)
+    : dirigido(grafo.esDirigido()), roto(false), parte(particion.parte) {
+    auto inicio = std::chrono::steady_clock::now();
+    const int n = grafo.cantidadVertices();
+    if (static_cast<int>(parte.size()) != n)
+        throw std::invalid_argument("La particion no corresponde al grafo");
+
+    std::vector<std::vector<int> > miembros(particion.partes);
+    std::vector<int> local(n, -1);
+    for (int v = 0; v < n; v++) {
+        if (parte[v] < 0) continue;
+        if (parte[v] >= particion.partes)
+            throw std::invalid_argument("Parte fuera de rango");
+        local[v] = miembros[parte[v]].size();
+        miembros[parte[v]].push_back(v);
+    }
+
+    // Los arcos de corte van al overlay; sus extremos son los bordes de cada parte.
+    std::vector<std::vector<std::pair<int, double> > > arcosCorte(n);
+    std::vector<char> esBorde(n, 0);
+    for (int v = 0; v < n; v++) {
+        if (parte[v] < 0) continue;
+        for (const auto &adyacente: grafo.adyacentesDe(v)) {
+            int w = adyacente.indiceVertice;
+            if (parte[w] < 0 || parte[w] == parte[v]) continue;
+            arcosCorte[v].emplace_back(w, peso(adyacente));
+            esBorde[v] = esBorde[w] = 1;
+        }
+    }
+
+    // Cada parte se arma, se guarda y se lanza antes de pasar a la siguiente: el
+    // coordinador nunca tiene más de un subgrafo en memoria. Si algo falla a mitad de
+    // camino el destructor no corre, así que se detiene a mano.
+    try {
+        for (int p = 0; p < particion.partes; p++) {
+            DatosShard shard;
+            shard.globales = std::move(miembros[p]);
+            shard.desplazamientos.assign(1, 0);
+            for (int v: shard.globales) {
+                for (const auto &adyacente: grafo.adyacentesDe(v))
+                    if (parte[adyacente.indiceVertice] == p)
+                        shard.arcos.emplace_back(local[adyacente.indiceVertice], peso(adyacente), 0);
+                shard.desplazamientos.push_back(shard.arcos.size());
+                if (esBorde[v]) shard.bordes.push_back(v);
+            }
+            lanzarTrabajador(shard);
+        }
+        construirOverlay(arcosCorte);
+    } catch (...) {
+        detener();
+        throw;
+    }
+    estadisticasCoordinador.segundosConstruccion =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
@@ -0,0 +1,77 @@
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+#include <vector>
+
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+#include "../GrafoCompacto.h"
+
+struct ResultadoDeltaStepping {
+    std::vector<double> costos;
+    std::vector<int> predecesores;
+};
+
+struct MedicionEscalado {
+    int hilos;
+    double segundos;
+    double aceleracion;
+};
+
+// SSSP por delta-stepping (Meyer y Sanders) sobre un GrafoCompacto. Los arcos se
+// separan en livianos (peso <= delta) y pesados; los livianos de cada cubeta se
+// relajan por fases en paralelo y los pesados una vez al vaciarla. Las solicitudes
+// de relajación se reparten por vértice destino entre hilos, sin atómicos.
+// Sólo una mejora estricta cambia el predecesor, así que los predecesores forman un
+// árbol aun con aristas de peso 0. Ante varios caminos mínimos el árbol elegido (y el
+// redondeo del costo) puede variar con la cantidad de hilos. El grafo debe seguir vivo
+// mientras se use la búsqueda: los filtros reciben sus arcos originales.
+template<typename T, typename Politica = PesoDistancia>
+class DeltaStepping {
+    struct ArcoPesado {
+        int destino;
+        // Posición en grafo.getArcos(), para consultar el filtro.
+        int original;
+        double peso;
+    };
+
+    struct Solicitud {
+        int destino;
+        int predecesor;
+        double costo;
+    };
+
+private:
+    const GrafoCompacto<T> &grafo;
+    int n;
+    double delta;
+    int hilos;
+    std::vector<int> desplazamientosLivianos;
+    std::vector<ArcoPesado> livianos;
+    std::vector<int> desplazamientosPesados;
+    std::vector<ArcoPesado> pesados;
+    int cantidadCubetas;
+
+    template<typename Filtro>
+    void relajar(const std::vector<int> &vertices, const std::vector<int> &desplazamientos,
+                 const std::vector<ArcoPesado> &arcos, ResultadoDeltaStepping &resultado,
+                 std::vector<std::vector<int> > &cubetas, const Filtro &filtro) const;
+
+public:
+    // delta <= 0 elige delta = peso máximo / grado promedio.
+    explicit DeltaStepping(const GrafoCompacto<T> &grafo, double delta = 0, int hilos = cantidadHilos(),
+                           Politica peso = Politica());
+
+    template<typename Filtro = SinFiltro>
+    ResultadoDeltaStepping ejecutar(int origen, const Filtro &filtro = Filtro()) const;
+
+    double getDelta() const { return delta; }
+
+    void setHilos(int hilos) { this->hilos = std::max(1, hilos); }
+
+    // Tiempo de ejecutar(origen) con 1, 2, 4, ... hasta maximoHilos hilos.
+    static std::vector<MedicionEscalado> medirEscalado(const GrafoCompacto<T> &grafo, int origen,
+                                                       int maximoHilos = cantidadHilos(), int repeticiones = 3);
+};
+
+#endif //DELTASTEPPING_H
+#include "DeltaStepping.tpp"
@@ -0,0 +1,166 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+template<typename T, typename Politica>
+DeltaStepping<T, Politica>::DeltaStepping(const GrafoCompacto<T> &grafo, double delta, int hilos, Politica peso)
+    : grafo(grafo), n(grafo.cantidadVertices()), delta(delta), hilos(std::max(1, hilos)) {
+    double pesoMaximo = 0;
+    for (const auto &arco: grafo.getArcos()) {
+        double valor = peso(arco);
+        if (!(valor >= 0))
+            throw std::invalid_argument("Delta-stepping requiere pesos no negativos");
+        pesoMaximo = std::max(pesoMaximo, valor);
+    }
+
+    if (this->delta <= 0) {
+        double gradoPromedio = n > 0 ? static_cast<double>(grafo.cantidadArcos()) / n : 1;
+        this->delta = pesoMaximo / std::max(1.0, gradoPromedio);
+    }
+    if (this->delta <= 0)
+        this->delta = 1;
+    // Una relajación cae a lo sumo pesoMaximo / delta cubetas más adelante.
+    cantidadCubetas = static_cast<int>(std::ceil(pesoMaximo / this->delta)) + 2;
+
+    desplazamientosLivianos.assign(n + 1, 0);
+    desplazamientosPesados.assign(n + 1, 0);
+    const auto &arcos = grafo.getArcos();
+    for (int v = 0; v < n; v++) {
+        for (int a = grafo.getDesplazamientos()[v]; a < grafo.getDesplazamientos()[v + 1]; a++) {
+            double valor = peso(arcos[a]);
+            if (valor <= this->delta)
+                livianos.push_back({arcos[a].indiceVertice, a, valor});
+            else
+                pesados.push_back({arcos[a].indiceVertice, a, valor});
+        }
+        desplazamientosLivianos[v + 1] = livianos.size();
+        desplazamientosPesados[v + 1] = pesados.size();
+    }
+}
+
+template<typename T, typename Politica>
+template<typename Filtro>
+void DeltaStepping<T, Politica>::relajar(const std::vector<int> &vertices, const std::vector<int> &desplazamientos,
+                                         const std::vector<ArcoPesado> &arcos, ResultadoDeltaStepping &resultado,
+                                         std::vector<std::vector<int> > &cubetas, const Filtro &filtro) const {
+    int hilosActivos = std::max(1, std::min<int>(hilos, vertices.size() / 64 + 1));
+
+    // Fase 1: cada hilo genera solicitudes, clasificadas por el hilo dueño del destino.
+    std::vector<std::vector<std::vector<Solicitud> > > solicitudes(
+        hilosActivos, std::vector<std::vector<Solicitud> >(hilosActivos));
+    ejecutarEnHilos(hilosActivos, [&](int idHilo) {
+        for (size_t i = idHilo; i < vertices.size(); i += hilosActivos) {
+            int v = vertices[i];
+            double costo = resultado.costos[v];
+            for (int a = desplazamientos[v]; a < desplazamientos[v + 1]; a++) {
+                const ArcoPesado &arco = arcos[a];
+                if (!filtro.permiteVertice(arco.destino) || !filtro.permiteArco(v, grafo.getArcos()[arco.original]))
+                    continue;
+                double nuevoCosto = costo + arco.peso;
+                if (nuevoCosto < resultado.costos[arco.destino])
+                    solicitudes[idHilo][arco.destino % hilosActivos].push_back({arco.destino, v, nuevoCosto});
+            }
+        }
+    });
+
+    // Fase 2: cada hilo aplica las solicitudes de sus vértices. Aceptar empates podría
+    // cerrar un ciclo de predecesores entre vértices unidos por aristas de peso 0.
+    std::vector<std::vector<int> > mejorados(hilosActivos);
+    ejecutarEnHilos(hilosActivos, [&](int idHilo) {
+        for (int origenSolicitud = 0; origenSolicitud < hilosActivos; origenSolicitud++) {
+            for (const Solicitud &solicitud: solicitudes[origenSolicitud][idHilo]) {
+                double &costo = resultado.costos[solicitud.destino];
+                int &predecesor = resultado.predecesores[solicitud.destino];
+                if (solicitud.costo < costo) {
+                    costo = solicitud.costo;
+                    predecesor = solicitud.predecesor;
+                    mejorados[idHilo].push_back(solicitud.destino);
+                }
+            }
+        }
+    });
+
+    for (const auto &lista: mejorados) {
+        for (int v: lista) {
+            long long indice = static_cast<long long>(resultado.costos[v] / delta);
+            cubetas[indice % cantidadCubetas].push_back(v);
+        }
+    }
+}
+
+template<typename T, typename Politica>
+template<typename Filtro>
+ResultadoDeltaStepping DeltaStepping<T, Politica>::ejecutar(int origen, const Filtro &filtro) const {
+    if (origen < 0 || origen >= n)
+        throw std::invalid_argument("Vertice de origen invalido");
+
+    ResultadoDeltaStepping resultado;
+    resultado.costos.assign(n, EspacioConsulta::INFINITO);
+    resultado.predecesores.assign(n, EspacioConsulta::SIN_PREDECESOR);
+    // Como en buscarCaminos, un origen bloqueado no alcanza nada.
+    if (!filtro.permiteVertice(origen))
+        return resultado;
+    resultado.costos[origen] = 0;
+
+    std::vector<std::vector<int> > cubetas(cantidadCubetas);
+    cubetas[0].push_back(origen);
+
+    // Sellos para descartar duplicados y entradas obsoletas sin reinicializar O(V).
+    MarcadoEpoca enFrontera(n);
+    MarcadoEpoca cerradosEnCubeta(n);
+    std::vector<int> frontera;
+    std::vector<int> cerrados;
+
+    int vacias = 0;
+    for (long long indice = 0; vacias < cantidadCubetas; indice++) {
+        std::vector<int> &cubeta = cubetas[indice % cantidadCubetas];
+        if (cubeta.empty()) {
+            vacias++;
+            continue;
+        }
+        vacias = 0;
+        cerradosEnCubeta.reiniciar();
+        cerrados.clear();
+
+        while (!cubeta.empty()) {
+            enFrontera.reiniciar();
+            frontera.clear();
+            for (int v: cubeta) {
+                if (static_cast<long long>(resultado.costos[v] / delta) != indice || enFrontera.estaMarcado(v))
+                    continue;
+                enFrontera.marcar(v);
+                frontera.push_back(v);
+                if (!cerradosEnCubeta.estaMarcado(v)) {
+                    cerradosEnCubeta.marcar(v);
+                    cerrados.push_back(v);
+                }
+            }
+            cubeta.clear();
+            relajar(frontera, desplazamientosLivianos, livianos, resultado, cubetas, filtro);
+        }
+        relajar(cerrados, desplazamientosPesados, pesados, resultado, cubetas, filtro);
+    }
+
+    return resultado;
+}
+
+template<typename T, typename Politica>
+std::vector<MedicionEscalado> DeltaStepping<T, Politica>::medirEscalado(const GrafoCompacto<T> &grafo, int origen,
+                                                                        int maximoHilos, int repeticiones) {
+    DeltaStepping busqueda(grafo);
+    std::vector<MedicionEscalado> mediciones;
+    for (int hilosMedidos = 1; hilosMedidos <= std::max(1, maximoHilos); hilosMedidos *= 2) {
+        busqueda.setHilos(hilosMedidos);
+        double mejor = 0;
+        for (int r = 0; r < std::max(1, repeticiones); r++) {
+            auto inicio = std::chrono::steady_clock::now();
+            busqueda.ejecutar(origen);
+            double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+            mejor = r == 0 ? segundos : std::min(mejor, segundos);
+        }
+        double base = mediciones.empty() ? mejor : mediciones.front().segundos;
+        mediciones.push_back({hilosMedidos, mejor, mejor > 0 ? base / mejor : 0});
+    }
+    return mediciones;
+}
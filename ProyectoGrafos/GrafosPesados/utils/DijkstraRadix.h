@@ -0,0 +1,65 @@
+#ifndef DIJKSTRARADIX_H
+#define DIJKSTRARADIX_H
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "MonticuloRadix.h"
+#include "../FiltroBusqueda.h"
+#include "../GrafoEntero.h"
+
+struct PesoMetros {
+    uint32_t operator()(const ArcoEntero &arco) const {
+        return arco.metros;
+    }
+};
+
+struct PesoSegundos {
+    uint32_t operator()(const ArcoEntero &arco) const {
+        return arco.segundos;
+    }
+};
+
+// Costos enteros (INFINITO si no se alcanzó) y predecesores de una búsqueda.
+struct ResultadoEntero {
+    std::vector<uint64_t> costos;
+    std::vector<int> predecesores;
+
+    std::vector<int> reconstruirCamino(int destino) const {
+        std::vector<int> camino;
+        if (destino < 0 || destino >= costos.size() || costos[destino] == std::numeric_limits<uint64_t>::max())
+            return camino;
+        for (int actual = destino; actual != -1; actual = predecesores[actual])
+            camino.push_back(actual);
+        std::reverse(camino.begin(), camino.end());
+        return camino;
+    }
+};
+
+struct ComparacionMonticulos {
+    int consultas = 0;
+    double segundosBinario = 0;
+    double segundosRadix = 0;
+    size_t bytesCompacto = 0;
+    size_t bytesEntero = 0;
+
+    double aceleracion() const {
+        return segundosRadix > 0 ? segundosBinario / segundosRadix : 0;
+    }
+};
+
+// Dijkstra con MonticuloRadix sobre pesos enteros. Con destino >= 0 se detiene al
+// cerrarlo. 'monticulo' y 'resultado' se reutilizan entre consultas. El filtro recibe
+// cada arco convertido con GrafoEntero::comoAdyacente.
+template<typename T, typename Politica = PesoMetros, typename Filtro = SinFiltro>
+void dijkstraRadix(const GrafoEntero<T> &grafo, int origen, ResultadoEntero &resultado, MonticuloRadix &monticulo,
+                   Politica peso = Politica(), int destino = -1, const Filtro &filtro = Filtro());
+
+// Mide las mismas consultas con buscarCaminos (montículo binario, double) y con
+// dijkstraRadix (enteros) desde orígenes repartidos uniformemente.
+template<typename T>
+ComparacionMonticulos compararMonticulos(const GrafoCompacto<T> &compacto, int consultas);
+
+#endif //DIJKSTRARADIX_H
+#include "DijkstraRadix.tpp"
@@ -0,0 +1,72 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "../BusquedaCaminos.h"
+
+template<typename T, typename Politica, typename Filtro>
+void dijkstraRadix(const GrafoEntero<T> &grafo, int origen, ResultadoEntero &resultado, MonticuloRadix &monticulo,
+                   Politica peso, int destino, const Filtro &filtro) {
+    const uint64_t INFINITO = GrafoEntero<T>::INFINITO;
+    int n = grafo.cantidadVertices();
+    if (origen < 0 || origen >= n)
+        throw std::invalid_argument("Vertice de origen invalido");
+
+    resultado.costos.assign(n, INFINITO);
+    resultado.predecesores.assign(n, -1);
+    monticulo.limpiar();
+    if (!filtro.permiteVertice(origen))
+        return;
+
+    resultado.costos[origen] = 0;
+    monticulo.insertar(0, origen);
+
+    while (!monticulo.estaVacio()) {
+        auto [costo, verticeActual] = monticulo.extraerMinimo();
+        // Entrada obsoleta
+        if (costo > resultado.costos[verticeActual]) continue;
+        if (verticeActual == destino) return;
+
+        for (const ArcoEntero &arco: grafo.adyacentesDe(verticeActual)) {
+            if (!filtro.permiteVertice(arco.indiceVertice) ||
+                !filtro.permiteArco(verticeActual, grafo.comoAdyacente(arco)))
+                continue;
+            uint64_t nuevoCosto = costo + peso(arco);
+            if (nuevoCosto < resultado.costos[arco.indiceVertice]) {
+                resultado.costos[arco.indiceVertice] = nuevoCosto;
+                resultado.predecesores[arco.indiceVertice] = verticeActual;
+                monticulo.insertar(nuevoCosto, arco.indiceVertice);
+            }
+        }
+    }
+}
+
+template<typename T>
+ComparacionMonticulos compararMonticulos(const GrafoCompacto<T> &compacto, int consultas) {
+    ComparacionMonticulos comparacion;
+    int n = compacto.cantidadVertices();
+    if (n == 0 || consultas <= 0)
+        return comparacion;
+
+    GrafoEntero<T> entero = GrafoEntero<T>::desdeCompacto(compacto);
+    comparacion.consultas = consultas;
+    comparacion.bytesCompacto = compacto.getDesplazamientos().size() * sizeof(int) +
+                                compacto.getArcos().size() * sizeof(AdyacenteConPeso);
+    comparacion.bytesEntero = entero.bytesTopologia();
+
+    EspacioConsulta espacio;
+    auto inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < consultas; i++)
+        buscarCaminos(compacto, static_cast<int>(static_cast<long long>(i) * n / consultas), espacio);
+    comparacion.segundosBinario = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    ResultadoEntero resultado;
+    MonticuloRadix monticulo;
+    inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < consultas; i++)
+        dijkstraRadix(entero, static_cast<int>(static_cast<long long>(i) * n / consultas), resultado, monticulo);
+    comparacion.segundosRadix = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    return comparacion;
+}
@@ -0,0 +1,223 @@
+#include "EtiquetadoHubs.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<EtiquetadoHubs::Etiqueta> && sizeof(EtiquetadoHubs::Etiqueta) == 16);
+
+EtiquetadoHubs::EtiquetadoHubs() : n(0), dirigido(false), conPadres(false), segundosConstruccion(0) {
+}
+
+void EtiquetadoHubs::apuntarAlmacen() {
+    orden = almacen.orden;
+    desplazamientosSalida = almacen.desplazamientosSalida;
+    salida = almacen.salida;
+    desplazamientosEntrada = almacen.desplazamientosEntrada;
+    entrada = almacen.entrada;
+}
+
+int EtiquetadoHubs::mejorHub(int origen, int destino, double &distancia) const {
+    if (origen < 0 || origen >= n || destino < 0 || destino >= n)
+        throw std::invalid_argument("Vertice fuera de rango");
+
+    // Ambas listas están ordenadas por rango del hub: se intersectan como en una fusión.
+    auto desde = etiquetasSalida(origen);
+    auto hasta = etiquetasEntrada(destino);
+    distancia = EspacioConsulta::INFINITO;
+    int mejor = -1;
+    size_t i = 0, j = 0;
+    while (i < desde.size() && j < hasta.size()) {
+        if (desde[i].hub < hasta[j].hub) {
+            i++;
+        } else if (desde[i].hub > hasta[j].hub) {
+            j++;
+        } else {
+            double candidata = desde[i].distancia + hasta[j].distancia;
+            if (candidata < distancia) {
+                distancia = candidata;
+                mejor = desde[i].hub;
+            }
+            i++;
+            j++;
+        }
+    }
+    return mejor;
+}
+
+const EtiquetadoHubs::Etiqueta *EtiquetadoHubs::buscarHub(std::span<const Etiqueta> etiquetas, int hub) {
+    auto posicion = std::lower_bound(etiquetas.begin(), etiquetas.end(), hub,
+                                     [](const Etiqueta &etiqueta, int valor) { return etiqueta.hub < valor; });
+    return posicion != etiquetas.end() && posicion->hub == hub ? &*posicion : nullptr;
+}
+
+double EtiquetadoHubs::distancia(int origen, int destino) const {
+    if (origen == destino && origen >= 0 && origen < n)
+        return 0;
+    double resultado;
+    mejorHub(origen, destino, resultado);
+    return resultado;
+}
+
+std::vector<int> EtiquetadoHubs::camino(int origen, int destino) const {
+    if (!conPadres)
+        throw std::logic_error("El etiquetado se construyo sin padres");
+    if (origen == destino && origen >= 0 && origen < n)
+        return {origen};
+
+    double costo;
+    int rango = mejorHub(origen, destino, costo);
+    if (rango < 0)
+        return {};
+    if (rango >= n)
+        throw std::logic_error("Etiquetas de hubs inconsistentes");
+    const int hub = orden[rango];
+
+    // Cada vértice etiquetado por un hub tiene a su padre también etiquetado por él
+    // (la búsqueda podada sólo expande vértices que recibieron etiqueta).
+    // Un camino mínimo tiene a lo sumo n vértices: más pasos delatan un ciclo de padres.
+    auto subirHastaHub = [&](int vertice, bool haciaAdelante) {
+        std::vector<int> tramo{vertice};
+        while (vertice != hub) {
+            if (tramo.size() > static_cast<size_t>(n))
+                throw std::logic_error("Etiquetas de hubs inconsistentes");
+            const Etiqueta *etiqueta = buscarHub(haciaAdelante ? etiquetasSalida(vertice)
+                                                               : etiquetasEntrada(vertice), rango);
+            if (etiqueta == nullptr || etiqueta->padre < 0 || etiqueta->padre >= n)
+                throw std::logic_error("Etiquetas de hubs inconsistentes");
+            vertice = etiqueta->padre;
+            tramo.push_back(vertice);
+        }
+        return tramo;
+    };
+
+    std::vector<int> resultado = subirHastaHub(origen, true);
+    std::vector<int> final = subirHastaHub(destino, false);
+    resultado.insert(resultado.end(), final.rbegin() + 1, final.rend());
+    return resultado;
+}
+
+EstadisticasEtiquetas EtiquetadoHubs::estadisticas() const {
+    EstadisticasEtiquetas estadisticas;
+    estadisticas.cantidadVertices = n;
+    estadisticas.totalEtiquetas = salida.size() + entrada.size();
+    for (int v = 0; v < n; v++) {
+        size_t propias = etiquetasSalida(v).size() + (dirigido ? etiquetasEntrada(v).size() : 0);
+        estadisticas.maximoPorVertice = std::max(estadisticas.maximoPorVertice, propias);
+    }
+    estadisticas.bytes = orden.size_bytes() + desplazamientosSalida.size_bytes() + salida.size_bytes() +
+                         desplazamientosEntrada.size_bytes() + entrada.size_bytes();
+    estadisticas.segundosConstruccion = segundosConstruccion;
+    return estadisticas;
+}
+
+void EtiquetadoHubs::guardar(const std::string &ruta) const {
+    Cabecera cabecera{};
+    std::memcpy(cabecera.magia, "GRHL", 4);
+    cabecera.version = VERSION;
+    cabecera.marcaEndian = MARCA_ENDIAN;
+    cabecera.banderas = (dirigido ? BANDERA_DIRIGIDO : 0) | (conPadres ? BANDERA_PADRES : 0);
+    cabecera.cantidadVertices = n;
+    cabecera.etiquetasSalida = salida.size();
+    cabecera.etiquetasEntrada = entrada.size();
+
+    const std::string rutaTemporal = ruta + ".tmp";
+    std::ofstream archivoSalida(rutaTemporal, std::ios::binary | std::ios::trunc);
+    if (!archivoSalida)
+        throw std::runtime_error("No se pudo crear el archivo: " + ruta);
+
+    const char relleno[8] = {};
+    auto escribir = [&archivoSalida, &relleno](const void *datos, size_t bytes) {
+        archivoSalida.write(static_cast<const char *>(datos), bytes);
+        archivoSalida.write(relleno, alinear(bytes) - bytes);
+    };
+
+    escribir(&cabecera, sizeof(cabecera));
+    escribir(orden.data(), orden.size_bytes());
+    escribir(desplazamientosSalida.data(), desplazamientosSalida.size_bytes());
+    escribir(salida.data(), salida.size_bytes());
+    if (dirigido) {
+        escribir(desplazamientosEntrada.data(), desplazamientosEntrada.size_bytes());
+        escribir(entrada.data(), entrada.size_bytes());
+    }
+
+    archivoSalida.close();
+    if (!archivoSalida)
+        throw std::runtime_error("No se pudo escribir el archivo: " + ruta);
+    reemplazarArchivo(rutaTemporal, ruta);
+}
+
+EtiquetadoHubs EtiquetadoHubs::cargar(const std::string &ruta) {
+    auto archivo = std::make_unique<ArchivoMapeado>(ruta);
+    const char *datos = archivo->getDatos();
+    const size_t tamano = archivo->getTamano();
+
+    Cabecera cabecera{};
+    if (tamano < sizeof(Cabecera))
+        throw std::invalid_argument("Etiquetado truncado: " + ruta);
+    std::memcpy(&cabecera, datos, sizeof(Cabecera));
+
+    if (std::memcmp(cabecera.magia, "GRHL", 4) != 0)
+        throw std::invalid_argument("El archivo no es un etiquetado de hubs: " + ruta);
+    if (cabecera.marcaEndian != MARCA_ENDIAN)
+        throw std::invalid_argument("Etiquetado con orden de bytes incompatible");
+    if (cabecera.version != VERSION)
+        throw std::invalid_argument("Version de etiquetado no soportada: " + std::to_string(cabecera.version));
+
+    const bool dirigido = (cabecera.banderas & BANDERA_DIRIGIDO) != 0;
+    const uint64_t n = cabecera.cantidadVertices;
+    if (n >= static_cast<uint64_t>(INT32_MAX) || (!dirigido && cabecera.etiquetasEntrada != 0))
+        throw std::invalid_argument("Etiquetado corrupto: " + ruta);
+
+    size_t posicion = alinear(sizeof(Cabecera));
+    auto seccion = [&](auto *tipo, uint64_t cantidad) {
+        using Elemento = std::remove_pointer_t<decltype(tipo)>;
+        if (cantidad > (tamano - posicion) / sizeof(Elemento))
+            throw std::invalid_argument("Etiquetado truncado: " + ruta);
+        std::span<const Elemento> vista(reinterpret_cast<const Elemento *>(datos + posicion), cantidad);
+        posicion += alinear(cantidad * sizeof(Elemento));
+        posicion = std::min(posicion, tamano);
+        return vista;
+    };
+
+    EtiquetadoHubs resultado;
+    resultado.n = static_cast<int>(n);
+    resultado.dirigido = dirigido;
+    resultado.conPadres = (cabecera.banderas & BANDERA_PADRES) != 0;
+    resultado.orden = seccion(static_cast<int32_t *>(nullptr), n);
+    resultado.desplazamientosSalida = seccion(static_cast<uint64_t *>(nullptr), n + 1);
+    resultado.salida = seccion(static_cast<Etiqueta *>(nullptr), cabecera.etiquetasSalida);
+    if (dirigido) {
+        resultado.desplazamientosEntrada = seccion(static_cast<uint64_t *>(nullptr), n + 1);
+        resultado.entrada = seccion(static_cast<Etiqueta *>(nullptr), cabecera.etiquetasEntrada);
+    }
+
+    // Se validan los índices que usan las consultas; las etiquetas se recorren sin copiarse.
+    auto validarDesplazamientos = [&](std::span<const uint64_t> desplazamientos, uint64_t total) {
+        if (desplazamientos.front() != 0 || desplazamientos.back() != total)
+            throw std::invalid_argument("Desplazamientos de etiquetas inconsistentes");
+        for (uint64_t v = 0; v < n; v++)
+            if (desplazamientos[v] > desplazamientos[v + 1])
+                throw std::invalid_argument("Desplazamientos de etiquetas inconsistentes");
+    };
+    validarDesplazamientos(resultado.desplazamientosSalida, cabecera.etiquetasSalida);
+    if (dirigido)
+        validarDesplazamientos(resultado.desplazamientosEntrada, cabecera.etiquetasEntrada);
+    for (int32_t vertice: resultado.orden)
+        if (vertice < 0 || static_cast<uint64_t>(vertice) >= n)
+            throw std::invalid_argument("Orden de hubs fuera de rango");
+    auto validarEtiquetas = [&](std::span<const Etiqueta> etiquetas) {
+        for (const Etiqueta &etiqueta: etiquetas)
+            if (etiqueta.hub < 0 || static_cast<uint64_t>(etiqueta.hub) >= n || etiqueta.padre < -1 ||
+                etiqueta.padre >= static_cast<int64_t>(n))
+                throw std::invalid_argument("Etiqueta de hub fuera de rango");
+    };
+    validarEtiquetas(resultado.salida);
+    validarEtiquetas(resultado.entrada);
+
+    resultado.archivo = std::move(archivo);
+    return resultado;
+}
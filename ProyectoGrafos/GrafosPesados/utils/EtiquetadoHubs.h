@@ -0,0 +1,139 @@
+#ifndef ETIQUETADOHUBS_H
+#define ETIQUETADOHUBS_H
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ArchivoMapeado.h"
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+#include "../GrafoCompacto.h"
+
+struct EstadisticasEtiquetas {
+    int cantidadVertices = 0;
+    size_t totalEtiquetas = 0;
+    size_t maximoPorVertice = 0;
+    size_t bytes = 0;
+    double segundosConstruccion = 0;
+
+    double promedioPorVertice() const {
+        return cantidadVertices > 0 ? static_cast<double>(totalEtiquetas) / cantidadVertices : 0;
+    }
+};
+
+// Oráculo de distancias por etiquetado de hubs (pruned landmark labeling, Akiba et al.).
+// Cada vértice guarda una lista corta de (hub, distancia) ordenada por hub; la distancia
+// entre s y t es el mínimo sobre los hubs comunes, una intersección de dos listas.
+// Los hubs se procesan por grado decreciente con Dijkstras podados: un vértice ya
+// cubierto por hubs anteriores no recibe etiqueta ni se expande. En grafos dirigidos hay
+// etiquetas de salida (s -> hub) y de entrada (hub -> t).
+// Formato en disco (secciones alineadas a 8 bytes, proyectable con mmap):
+//   cabecera | orden (n x i32) | desplazamientos de salida (n+1 x u64) | etiquetas de salida
+//   | [dirigido: desplazamientos de entrada | etiquetas de entrada]
+class EtiquetadoHubs {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t MARCA_ENDIAN = 0x01020304;
+    static constexpr uint32_t BANDERA_DIRIGIDO = 1;
+    static constexpr uint32_t BANDERA_PADRES = 2;
+
+    // El padre es el vecino siguiente hacia el hub; ocupa el relleno de alineación.
+    struct Etiqueta {
+        int32_t hub;
+        int32_t padre;
+        double distancia;
+    };
+
+    struct Cabecera {
+        char magia[4];
+        uint32_t version;
+        uint32_t marcaEndian;
+        uint32_t banderas;
+        uint64_t cantidadVertices;
+        uint64_t etiquetasSalida;
+        uint64_t etiquetasEntrada;
+    };
+
+private:
+    struct Almacen {
+        std::vector<int32_t> orden;
+        std::vector<uint64_t> desplazamientosSalida;
+        std::vector<Etiqueta> salida;
+        std::vector<uint64_t> desplazamientosEntrada;
+        std::vector<Etiqueta> entrada;
+    };
+
+    int n;
+    bool dirigido;
+    bool conPadres;
+    // Las vistas apuntan al almacén propio o al archivo proyectado.
+    std::span<const int32_t> orden;
+    std::span<const uint64_t> desplazamientosSalida;
+    std::span<const Etiqueta> salida;
+    std::span<const uint64_t> desplazamientosEntrada;
+    std::span<const Etiqueta> entrada;
+    Almacen almacen;
+    std::unique_ptr<ArchivoMapeado> archivo;
+    double segundosConstruccion;
+
+    EtiquetadoHubs();
+
+    void apuntarAlmacen();
+
+    std::span<const Etiqueta> etiquetasSalida(int vertice) const {
+        return salida.subspan(desplazamientosSalida[vertice],
+                              desplazamientosSalida[vertice + 1] - desplazamientosSalida[vertice]);
+    }
+
+    std::span<const Etiqueta> etiquetasEntrada(int vertice) const {
+        if (!dirigido) return etiquetasSalida(vertice);
+        return entrada.subspan(desplazamientosEntrada[vertice],
+                               desplazamientosEntrada[vertice + 1] - desplazamientosEntrada[vertice]);
+    }
+
+    // Hub común de menor distancia (-1 si no hay) y esa distancia.
+    int mejorHub(int origen, int destino, double &distancia) const;
+
+    static const Etiqueta *buscarHub(std::span<const Etiqueta> etiquetas, int hub);
+
+    static size_t alinear(size_t bytes) { return (bytes + 7) & ~static_cast<size_t>(7); }
+
+public:
+    // Mover los vectores o el mapeo conserva sus direcciones, así que las vistas siguen válidas.
+    EtiquetadoHubs(EtiquetadoHubs &&) noexcept = default;
+
+    EtiquetadoHubs &operator=(EtiquetadoHubs &&) noexcept = default;
+
+    EtiquetadoHubs(const EtiquetadoHubs &) = delete;
+
+    EtiquetadoHubs &operator=(const EtiquetadoHubs &) = delete;
+
+    // Los hubs de un lote de 'hilos' vértices se calculan en paralelo contra las
+    // etiquetas de los lotes anteriores; con un hilo es el algoritmo secuencial exacto.
+    template<typename T, typename Politica = PesoDistancia>
+    static EtiquetadoHubs construir(const GrafoCompacto<T> &grafo, int hilos = cantidadHilos(),
+                                    bool conPadres = true, Politica peso = Politica());
+
+    int cantidadVertices() const { return n; }
+
+    bool esDirigido() const { return dirigido; }
+
+    bool tienePadres() const { return conPadres; }
+
+    // Distancia mínima de origen a destino; EspacioConsulta::INFINITO si no hay camino.
+    double distancia(int origen, int destino) const;
+
+    std::vector<int> camino(int origen, int destino) const;
+
+    EstadisticasEtiquetas estadisticas() const;
+
+    void guardar(const std::string &ruta) const;
+
+    // Proyecta el archivo en memoria: las etiquetas no se copian.
+    static EtiquetadoHubs cargar(const std::string &ruta);
+};
+
+#endif //ETIQUETADOHUBS_H
+#include "EtiquetadoHubs.tpp"
@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include "../EspacioConsulta.h"
+
+template<typename T, typename Politica>
+EtiquetadoHubs EtiquetadoHubs::construir(const GrafoCompacto<T> &grafo, int hilos, bool conPadres, Politica peso) {
+    auto inicio = std::chrono::steady_clock::now();
+    const int n = grafo.cantidadVertices();
+    const bool dirigido = grafo.esDirigido();
+    const GrafoCompacto<T> inverso = dirigido ? grafo.transpuesto() : GrafoCompacto<T>();
+    hilos = std::max(1, hilos);
+
+    // Los vértices de mayor grado cubren más caminos: se procesan primero.
+    std::vector<int> grados(n);
+    for (int v = 0; v < n; v++)
+        grados[v] = grafo.adyacentesDe(v).size() + (dirigido ? inverso.adyacentesDe(v).size() : 0);
+    std::vector<int32_t> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    std::stable_sort(orden.begin(), orden.end(), [&grados](int a, int b) { return grados[a] > grados[b]; });
+
+    // Etiquetas de lotes ya terminados, ordenadas por rango del hub. En no dirigidos sólo
+    // se usa 'salida'; en dirigidos salida[v] guarda v -> hub y entrada[v] hub -> v.
+    std::vector<std::vector<Etiqueta> > salida(n), entrada(dirigido ? n : 0);
+    auto &destinoAdelante = dirigido ? entrada : salida;
+
+    std::vector<EspacioConsulta> espacios(hilos);
+    std::vector<std::vector<double> > distanciasHub(hilos, std::vector<double>(n, EspacioConsulta::INFINITO));
+
+    using Nueva = std::pair<int, Etiqueta>;
+    // Dijkstra podado desde el hub: un vértice cuya distancia ya se obtiene con hubs
+    // anteriores no recibe etiqueta ni expande sus arcos.
+    auto buscarPodado = [&](const GrafoCompacto<T> &recorrido, int rango, const std::vector<Etiqueta> &propias,
+                            const std::vector<std::vector<Etiqueta> > &consultadas, int idHilo,
+                            std::vector<Nueva> &nuevas) {
+        EspacioConsulta &espacio = espacios[idHilo];
+        std::vector<double> &distancias = distanciasHub[idHilo];
+        for (const auto &etiqueta: propias)
+            distancias[etiqueta.hub] = etiqueta.distancia;
+
+        const int hub = orden[rango];
+        espacio.preparar(n);
+        espacio.relajar(hub, 0, EspacioConsulta::SIN_PREDECESOR);
+        espacio.insertarEnMonticulo(0, hub);
+        while (!espacio.monticuloVacio()) {
+            auto [costo, vertice] = espacio.extraerMinimo();
+            if (espacio.estaCerrado(vertice)) continue;
+            espacio.cerrar(vertice);
+
+            double cubierta = EspacioConsulta::INFINITO;
+            for (const auto &etiqueta: consultadas[vertice])
+                cubierta = std::min(cubierta, distancias[etiqueta.hub] + etiqueta.distancia);
+            if (cubierta <= costo) continue;
+
+            int padre = conPadres ? espacio.getPredecesor(vertice) : EspacioConsulta::SIN_PREDECESOR;
+            nuevas.emplace_back(vertice, Etiqueta{rango, padre, costo});
+            for (const auto &adyacente: recorrido.adyacentesDe(vertice)) {
+                if (espacio.estaCerrado(adyacente.indiceVertice)) continue;
+                double nuevoCosto = costo + peso(adyacente);
+                if (espacio.relajar(adyacente.indiceVertice, nuevoCosto, vertice))
+                    espacio.insertarEnMonticulo(nuevoCosto, adyacente.indiceVertice);
+            }
+        }
+
+        for (const auto &etiqueta: propias)
+            distancias[etiqueta.hub] = EspacioConsulta::INFINITO;
+    };
+
+    // Dentro de un lote los hubs no se podan entre sí: sobran algunas etiquetas pero la
+    // cobertura sigue siendo exacta. Los primeros hubs van en lotes de 'hilos'; al final,
+    // donde cada búsqueda se poda casi de inmediato, los lotes crecen para repartir mejor.
+    std::vector<std::vector<Nueva> > adelante, atras;
+    for (int primero = 0; primero < n;) {
+        int tamLote = hilos == 1 ? 1 : std::max(hilos, primero / 64);
+        int ultimo = std::min(n, primero + tamLote);
+        adelante.assign(ultimo - primero, {});
+        atras.assign(dirigido ? ultimo - primero : 0, {});
+
+        paraCadaIndice(ultimo - primero, hilos, [&](size_t i, int idHilo) {
+            int rango = primero + static_cast<int>(i);
+            int hub = orden[rango];
+            buscarPodado(grafo, rango, salida[hub], destinoAdelante, idHilo, adelante[i]);
+            if (dirigido)
+                buscarPodado(inverso, rango, entrada[hub], salida, idHilo, atras[i]);
+        }, 1);
+
+        // Se agregan en orden de rango para mantener cada lista ordenada por hub.
+        for (int i = 0; i < ultimo - primero; i++) {
+            for (const auto &[vertice, etiqueta]: adelante[i])
+                destinoAdelante[vertice].push_back(etiqueta);
+            if (dirigido)
+                for (const auto &[vertice, etiqueta]: atras[i])
+                    salida[vertice].push_back(etiqueta);
+        }
+        primero = ultimo;
+    }
+
+    auto aplanar = [n](std::vector<std::vector<Etiqueta> > &listas, std::vector<uint64_t> &desplazamientos,
+                       std::vector<Etiqueta> &etiquetas) {
+        desplazamientos.assign(n + 1, 0);
+        for (int v = 0; v < n; v++)
+            desplazamientos[v + 1] = desplazamientos[v] + listas[v].size();
+        etiquetas.reserve(desplazamientos[n]);
+        for (auto &lista: listas) {
+            etiquetas.insert(etiquetas.end(), lista.begin(), lista.end());
+            std::vector<Etiqueta>().swap(lista);
+        }
+    };
+
+    EtiquetadoHubs resultado;
+    resultado.n = n;
+    resultado.dirigido = dirigido;
+    resultado.conPadres = conPadres;
+    resultado.almacen.orden = std::move(orden);
+    aplanar(salida, resultado.almacen.desplazamientosSalida, resultado.almacen.salida);
+    if (dirigido)
+        aplanar(entrada, resultado.almacen.desplazamientosEntrada, resultado.almacen.entrada);
+    resultado.apuntarAlmacen();
+    resultado.segundosConstruccion = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
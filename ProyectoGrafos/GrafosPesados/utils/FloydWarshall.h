@@ -6,11 +6,12 @@
 #define FLOYDWARSHALL_H
 #include <vector>
 
+#include "OraculoDistancia.h"
 #include "../GrafoPesado.h"
 
 
 template<typename T>
-class FloydWarshall {
+class FloydWarshall : public OraculoDistancia {
     struct CaminoResultadoFloyd {
         std::vector<T> camino;
         double distanciaTotal;
@@ -33,7 +34,7 @@ public:
     void inicializarMatrices();
     const std::vector<std::vector<double>>& getMatrizDePesos() const;
     const std::vector<std::vector<int>>& getMatrizDePredecesores() const;
-    double obtenerDistanciaCamino(int nroOrigen, int nroDestino) const;
+    double obtenerDistanciaCamino(int nroOrigen, int nroDestino) const override;
     std::vector<T> obtenerCaminoCompleto(const T &verticeOrigen, const T &verticeDestino) const;
 };
 
@@ -43,6 +43,8 @@ void FloydWarshall<T>::inicializarMatrices() {
     }
 
     for (int i = 0; i < n; i++) {
+        if (grafo.estaEliminado(i))
+            continue;
         T vertice = listaVertices[i];
         auto adyacentes = grafo.getAdyacentesDelVertice(vertice);
         for (const auto &adyacente : adyacentes) {
@@ -0,0 +1,162 @@
+#include "FlujoMaximo.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+
+void FlujoMaximo::construir(const std::vector<int> &origenes, const std::vector<int> &destinos,
+                            const std::vector<int64_t> &directas, const std::vector<int64_t> &inversas) {
+    desplazamientos.assign(n + 1, 0);
+    for (size_t i = 0; i < origenes.size(); i++) {
+        desplazamientos[origenes[i] + 1]++;
+        desplazamientos[destinos[i] + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+        desplazamientos[v + 1] += desplazamientos[v];
+
+    std::vector<int> posiciones(desplazamientos.begin(), desplazamientos.end() - 1);
+    arcos.resize(desplazamientos.back());
+    capacidades.resize(desplazamientos.back());
+    for (size_t i = 0; i < origenes.size(); i++) {
+        int directo = posiciones[origenes[i]]++;
+        int inverso = posiciones[destinos[i]]++;
+        arcos[directo] = {destinos[i], inverso, directas[i]};
+        arcos[inverso] = {origenes[i], directo, inversas[i]};
+        capacidades[directo] = directas[i];
+        capacidades[inverso] = inversas[i];
+    }
+
+    niveles.assign(n, -1);
+    actuales.assign(n, 0);
+    cola.reserve(n);
+}
+
+bool FlujoMaximo::calcularNiveles(int fuente, int sumidero) {
+    std::fill(niveles.begin(), niveles.end(), -1);
+    cola.clear();
+    niveles[fuente] = 0;
+    cola.push_back(fuente);
+    // Los vértices más allá del nivel del sumidero no pertenecen a ningún camino más corto.
+    for (size_t i = 0; i < cola.size() && niveles[sumidero] < 0; i++) {
+        int v = cola[i];
+        for (int a = desplazamientos[v]; a < desplazamientos[v + 1]; a++) {
+            if (arcos[a].residual > 0 && niveles[arcos[a].destino] < 0) {
+                niveles[arcos[a].destino] = niveles[v] + 1;
+                cola.push_back(arcos[a].destino);
+            }
+        }
+    }
+    return niveles[sumidero] >= 0;
+}
+
+int64_t FlujoMaximo::flujoBloqueante(int fuente, int sumidero, int64_t restante) {
+    // DFS iterativa con puntero al arco actual: cada arco se descarta a lo sumo una vez
+    // por fase y tras aumentar se retrocede solo hasta el primer arco saturado.
+    for (int v = 0; v < n; v++)
+        actuales[v] = desplazamientos[v];
+    camino.clear();
+    int64_t total = 0;
+    int v = fuente;
+    while (total < restante) {
+        if (v == sumidero) {
+            int64_t cuello = restante - total;
+            for (int a: camino)
+                cuello = std::min(cuello, arcos[a].residual);
+            size_t primeroSaturado = camino.size();
+            for (size_t i = 0; i < camino.size(); i++) {
+                arcos[camino[i]].residual -= cuello;
+                arcos[arcos[camino[i]].inverso].residual += cuello;
+                if (arcos[camino[i]].residual == 0 && primeroSaturado == camino.size())
+                    primeroSaturado = i;
+            }
+            total += cuello;
+            camino.resize(primeroSaturado);
+            v = camino.empty() ? fuente : arcos[camino.back()].destino;
+            continue;
+        }
+
+        int &a = actuales[v];
+        while (a < desplazamientos[v + 1] &&
+               (arcos[a].residual == 0 || niveles[arcos[a].destino] != niveles[v] + 1))
+            a++;
+        if (a < desplazamientos[v + 1]) {
+            camino.push_back(a);
+            v = arcos[a].destino;
+        } else {
+            niveles[v] = -1;
+            if (camino.empty())
+                break;
+            int arco = camino.back();
+            camino.pop_back();
+            v = arcos[arcos[arco].inverso].destino;
+            actuales[v]++;
+        }
+    }
+    return total;
+}
+
+ResultadoFlujo FlujoMaximo::calcular(int fuente, int sumidero) {
+    if (fuente < 0 || fuente >= n || sumidero < 0 || sumidero >= n)
+        throw std::invalid_argument("Vertice fuera de rango");
+    if (fuente == sumidero)
+        throw std::invalid_argument("La fuente y el sumidero deben ser distintos");
+
+    auto inicio = std::chrono::steady_clock::now();
+    for (size_t a = 0; a < arcos.size(); a++)
+        arcos[a].residual = capacidades[a];
+
+    ResultadoFlujo resultado;
+    while (resultado.flujo < limite && calcularNiveles(fuente, sumidero)) {
+        resultado.flujo += flujoBloqueante(fuente, sumidero, limite - resultado.flujo);
+        resultado.fases++;
+    }
+
+    if (resultado.flujo >= limite) {
+        resultado.ilimitado = true;
+    } else {
+        // Tras la última fase, los vértices con nivel son los alcanzables en la red residual.
+        resultado.ladoFuente.resize(n);
+        for (int v = 0; v < n; v++)
+            resultado.ladoFuente[v] = niveles[v] >= 0;
+        for (int v = 0; v < n; v++) {
+            if (!resultado.ladoFuente[v]) continue;
+            for (int a = desplazamientos[v]; a < desplazamientos[v + 1]; a++) {
+                if (capacidades[a] > 0 && !resultado.ladoFuente[arcos[a].destino])
+                    resultado.corte.push_back({v, arcos[a].destino, capacidades[a]});
+            }
+        }
+    }
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
+
+GrafoCompacto<int> redFlujoSintetica(int vertices, int grado, uint32_t capacidadMaxima, unsigned semilla) {
+    if (vertices < 2 || grado < 1 || capacidadMaxima < 1 || capacidadMaxima == AdyacenteConPeso::SIN_CAPACIDAD)
+        throw std::invalid_argument("Parametros de red sintetica invalidos");
+
+    std::mt19937 generador(semilla);
+    std::uniform_int_distribution<int> vecinos(0, vertices - 2);
+    std::uniform_int_distribution<uint32_t> capacidades(1, capacidadMaxima);
+
+    std::vector<int> nombres(vertices);
+    std::vector<int> desplazamientos(vertices + 1, 0);
+    std::vector<AdyacenteConPeso> arcos;
+    arcos.reserve(static_cast<size_t>(vertices) * grado);
+    std::vector<int> destinos;
+    for (int v = 0; v < vertices; v++) {
+        nombres[v] = v;
+        destinos.assign(1, (v + 1) % vertices);
+        for (int i = 1; i < grado; i++) {
+            int w = vecinos(generador);
+            destinos.push_back(w >= v ? w + 1 : w); // nunca un lazo
+        }
+        // Listas ordenadas por vecino y sin aristas repetidas, como en GrafoPesado.
+        std::sort(destinos.begin(), destinos.end());
+        destinos.erase(std::unique(destinos.begin(), destinos.end()), destinos.end());
+        for (int w: destinos)
+            arcos.emplace_back(w, 1.0, 1.0, capacidades(generador));
+        desplazamientos[v + 1] = static_cast<int>(arcos.size());
+    }
+    return GrafoCompacto<int>(std::move(nombres), std::move(desplazamientos), std::move(arcos), true);
+}
@@ -0,0 +1,91 @@
+#ifndef FLUJOMAXIMO_H
+#define FLUJOMAXIMO_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../AdyacenteConPeso.h"
+#include "../GrafoCompacto.h"
+
+struct ArcoCorte {
+    int origen;
+    int destino;
+    int64_t capacidad;
+};
+
+struct ResultadoFlujo {
+    int64_t flujo = 0;
+    // Hay un camino de la fuente al sumidero formado solo por arcos sin capacidad.
+    bool ilimitado = false;
+    // Vértices del lado de la fuente en el corte mínimo; vacío si el flujo es ilimitado.
+    std::vector<bool> ladoFuente;
+    std::vector<ArcoCorte> corte;
+    int fases = 0;
+    double segundos = 0;
+};
+
+struct MedicionFlujo {
+    int vertices = 0;
+    size_t arcosResiduales = 0;
+    int consultas = 0;
+    double segundosConstruccion = 0;
+    double segundosPromedio = 0;
+    double segundosMaximo = 0;
+    double fasesPromedio = 0;
+};
+
+// Flujo máximo / corte mínimo con Dinic sobre una red residual en formato CSR, construida
+// una sola vez a partir de las capacidades de las aristas. En grafos no dirigidos cada
+// arista es un par de arcos opuestos que se usan mutuamente como residuales. Los arcos sin
+// capacidad (SIN_CAPACIDAD) reciben una cota mayor que la suma de todas las capacidades
+// finitas, así que el flujo alcanza esa cota solo si ningún corte finito los separa.
+class FlujoMaximo {
+private:
+    struct ArcoResidual {
+        int destino;
+        int inverso;
+        int64_t residual;
+    };
+
+    int n;
+    std::vector<int> desplazamientos;
+    std::vector<ArcoResidual> arcos;
+    std::vector<int64_t> capacidades;
+    int64_t limite;
+    std::vector<int> niveles;
+    std::vector<int> actuales;
+    std::vector<int> cola;
+    std::vector<int> camino;
+
+    void construir(const std::vector<int> &origenes, const std::vector<int> &destinos,
+                   const std::vector<int64_t> &directas, const std::vector<int64_t> &inversas);
+
+    bool calcularNiveles(int fuente, int sumidero);
+
+    int64_t flujoBloqueante(int fuente, int sumidero, int64_t restante);
+
+public:
+    template<typename Grafo>
+    explicit FlujoMaximo(const Grafo &grafo);
+
+    // Parte siempre de la red sin flujo, así que la misma instancia atiende varias consultas.
+    ResultadoFlujo calcular(int fuente, int sumidero);
+
+    int cantidadVertices() const { return n; }
+
+    size_t cantidadArcosResiduales() const { return arcos.size(); }
+
+    int64_t getLimite() const { return limite; }
+};
+
+// Red dirigida sintética para medir el flujo a gran escala: un ciclo v -> v + 1 que la
+// mantiene fuertemente conexa más 'grado' - 1 arcos a vecinos aleatorios por vértice, con
+// capacidades uniformes en [1, capacidadMaxima].
+GrafoCompacto<int> redFlujoSintetica(int vertices, int grado, uint32_t capacidadMaxima, unsigned semilla = 1);
+
+// Construye la red una vez y resuelve 'consultas' pares fuente/sumidero aleatorios.
+template<typename Grafo>
+MedicionFlujo medirFlujoMaximo(const Grafo &grafo, int consultas, unsigned semilla = 1);
+
+#endif //FLUJOMAXIMO_H
+#include "FlujoMaximo.tpp"
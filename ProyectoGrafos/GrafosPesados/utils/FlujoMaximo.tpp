@@ -0,0 +1,68 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+template<typename Grafo>
+FlujoMaximo::FlujoMaximo(const Grafo &grafo) : n(grafo.cantidadVertices()), limite(0) {
+    std::vector<int> origenes, destinos;
+    std::vector<int64_t> directas, inversas;
+    int64_t sumaFinitas = 0;
+    for (int v = 0; v < n; v++) {
+        for (const auto &adyacente: grafo.adyacentesDe(v)) {
+            int w = adyacente.indiceVertice;
+            // Los lazos no transportan flujo; en no dirigidos cada arista se toma una vez.
+            if (w == v || (!grafo.esDirigido() && w < v))
+                continue;
+            int64_t capacidad = adyacente.capacidad;
+            if (adyacente.capacidad == AdyacenteConPeso::SIN_CAPACIDAD)
+                capacidad = -1;
+            if (capacidad > 0)
+                sumaFinitas += capacidad;
+            origenes.push_back(v);
+            destinos.push_back(w);
+            directas.push_back(capacidad);
+            inversas.push_back(grafo.esDirigido() ? 0 : capacidad);
+        }
+    }
+
+    limite = sumaFinitas + 1;
+    for (size_t i = 0; i < directas.size(); i++) {
+        if (directas[i] < 0) directas[i] = limite;
+        if (inversas[i] < 0) inversas[i] = limite;
+    }
+    construir(origenes, destinos, directas, inversas);
+}
+
+template<typename Grafo>
+MedicionFlujo medirFlujoMaximo(const Grafo &grafo, int consultas, unsigned semilla) {
+    MedicionFlujo medicion;
+    auto inicio = std::chrono::steady_clock::now();
+    FlujoMaximo red(grafo);
+    medicion.segundosConstruccion = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    medicion.vertices = red.cantidadVertices();
+    medicion.arcosResiduales = red.cantidadArcosResiduales();
+    if (medicion.vertices < 2)
+        return medicion;
+
+    std::mt19937 generador(semilla);
+    std::uniform_int_distribution<int> distribucion(0, medicion.vertices - 1);
+    double total = 0;
+    long long fases = 0;
+    for (int c = 0; c < consultas; c++) {
+        int fuente = distribucion(generador);
+        int sumidero = distribucion(generador);
+        while (sumidero == fuente)
+            sumidero = distribucion(generador);
+        ResultadoFlujo resultado = red.calcular(fuente, sumidero);
+        total += resultado.segundos;
+        fases += resultado.fases;
+        medicion.segundosMaximo = std::max(medicion.segundosMaximo, resultado.segundos);
+        medicion.consultas++;
+    }
+    if (medicion.consultas > 0) {
+        medicion.segundosPromedio = total / medicion.consultas;
+        medicion.fasesPromedio = static_cast<double>(fases) / medicion.consultas;
+    }
+    return medicion;
+}
@@ -0,0 +1,78 @@
+#ifndef IMPORTADORCSV_H
+#define IMPORTADORCSV_H
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ArchivoMapeado.h"
+#include "../Coordenada.h"
+#include "../GrafoBuilder.h"
+
+struct EstadisticasImportacion {
+    size_t bytes = 0;
+    size_t lineas = 0;
+    size_t registros = 0;
+    double segundos = 0;
+
+    double mbPorSegundo() const {
+        return segundos > 0 ? bytes / (1024.0 * 1024.0) / segundos : 0;
+    }
+};
+
+// Importa redes desde archivos CSV/TSV proyectados en memoria:
+//   vertices: nombre, latitud, longitud
+//   aristas:  origen, destino, distancia, tiempo[, capacidad]
+// Los campos se leen como string_view sobre el mapeo (sin copias) y las páginas ya
+// procesadas se descartan, así que el archivo no queda entero en memoria. Lo que sí
+// crece con la red es lo que se entrega al GrafoBuilder (todas las aristas hasta
+// construir) y el índice de nombres, que el importador guarda además del builder.
+// Una primera línea no numérica, aunque tenga menos columnas, se toma como
+// encabezado. Los vértices desconocidos en el archivo de aristas se crean sin
+// coordenadas.
+template<typename T>
+class ImportadorCSV {
+public:
+    using Progreso = std::function<void(size_t bytesProcesados, size_t bytesTotales)>;
+
+private:
+    static constexpr size_t BLOQUE_PROGRESO = 4 << 20;
+    static constexpr int MAXIMO_CAMPOS = 5;
+
+    GrafoBuilder<T> &builder;
+    std::map<std::string, int, std::less<> > indicePorNombre;
+    std::vector<Coordenada> coordenadas;
+    Progreso progreso;
+
+    static std::string_view recortarCampo(std::string_view campo);
+
+    // Divide la línea en a lo sumo 'maximo' campos; respeta comillas dobles sin escapes.
+    static int dividirCampos(std::string_view linea, char separador, std::string_view *campos, int maximo);
+
+    static bool leerNumero(std::string_view campo, double &valor);
+
+    static bool esEncabezado(const std::string_view *campos, int cantidad);
+
+    static char detectarSeparador(std::string_view primeraLinea);
+
+    int obtenerVertice(std::string_view nombre);
+
+    template<typename ProcesarCampos>
+    EstadisticasImportacion recorrer(const std::string &ruta, int camposEsperados, ProcesarCampos procesar);
+
+public:
+    explicit ImportadorCSV(GrafoBuilder<T> &builder);
+
+    void setProgreso(Progreso progreso);
+
+    EstadisticasImportacion importarVertices(const std::string &ruta);
+
+    EstadisticasImportacion importarAristas(const std::string &ruta);
+
+    // Coordenadas indexadas por número de vértice del builder (NaN si no se conocen).
+    const std::vector<Coordenada> &getCoordenadas() const;
+};
+
+#endif
+#include "ImportadorCSV.tpp"
@@ -0,0 +1,181 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+template<typename T>
+std::string_view ImportadorCSV<T>::recortarCampo(std::string_view campo) {
+    while (!campo.empty() && (campo.front() == ' ' || campo.front() == '\t'))
+        campo.remove_prefix(1);
+    while (!campo.empty() && (campo.back() == ' ' || campo.back() == '\t'))
+        campo.remove_suffix(1);
+    if (campo.size() >= 2 && campo.front() == '"' && campo.back() == '"')
+        campo = campo.substr(1, campo.size() - 2);
+    return campo;
+}
+
+template<typename T>
+int ImportadorCSV<T>::dividirCampos(std::string_view linea, char separador, std::string_view *campos, int maximo) {
+    int cantidad = 0;
+    size_t inicio = 0;
+    while (cantidad < maximo && inicio <= linea.size()) {
+        size_t fin = inicio;
+        bool entreComillas = false;
+        while (fin < linea.size() && (entreComillas || linea[fin] != separador)) {
+            if (linea[fin] == '"') entreComillas = !entreComillas;
+            fin++;
+        }
+        campos[cantidad++] = recortarCampo(linea.substr(inicio, fin - inicio));
+        inicio = fin + 1;
+    }
+    return cantidad;
+}
+
+template<typename T>
+bool ImportadorCSV<T>::leerNumero(std::string_view campo, double &valor) {
+    auto resultado = std::from_chars(campo.data(), campo.data() + campo.size(), valor);
+    return resultado.ec == std::errc() && resultado.ptr == campo.data() + campo.size();
+}
+
+template<typename T>
+bool ImportadorCSV<T>::esEncabezado(const std::string_view *campos, int cantidad) {
+    // Sólo texto: ninguno de los campos que siguen al nombre es numérico.
+    double valor;
+    for (int i = 1; i < cantidad; i++)
+        if (campos[i].empty() || leerNumero(campos[i], valor)) return false;
+    return cantidad > 1 || !campos[0].empty();
+}
+
+template<typename T>
+char ImportadorCSV<T>::detectarSeparador(std::string_view primeraLinea) {
+    if (primeraLinea.find('\t') != std::string_view::npos) return '\t';
+    if (primeraLinea.find(',') == std::string_view::npos && primeraLinea.find(';') != std::string_view::npos)
+        return ';';
+    return ',';
+}
+
+template<typename T>
+ImportadorCSV<T>::ImportadorCSV(GrafoBuilder<T> &builder) : builder(builder) {
+}
+
+template<typename T>
+void ImportadorCSV<T>::setProgreso(Progreso progreso) {
+    this->progreso = std::move(progreso);
+}
+
+template<typename T>
+int ImportadorCSV<T>::obtenerVertice(std::string_view nombre) {
+    auto it = indicePorNombre.find(nombre);
+    if (it != indicePorNombre.end())
+        return it->second;
+
+    std::string copia(nombre);
+    int nroVertice = builder.agregarVertice(T::fromStdString(copia));
+    indicePorNombre.emplace(std::move(copia), nroVertice);
+    if (coordenadas.size() <= static_cast<size_t>(nroVertice))
+        coordenadas.resize(nroVertice + 1);
+    return nroVertice;
+}
+
+template<typename T>
+template<typename ProcesarCampos>
+EstadisticasImportacion ImportadorCSV<T>::recorrer(const std::string &ruta, int camposEsperados,
+                                                   ProcesarCampos procesar) {
+    auto inicio = std::chrono::steady_clock::now();
+
+    ArchivoMapeado archivo(ruta);
+    archivo.lecturaSecuencial();
+    const char *datos = archivo.getDatos();
+    const size_t tamano = archivo.getTamano();
+
+    EstadisticasImportacion estadisticas;
+    estadisticas.bytes = tamano;
+
+    char separador = ',';
+    bool primeraLinea = true;
+    size_t siguienteLiberacion = BLOQUE_PROGRESO;
+    std::string_view campos[MAXIMO_CAMPOS];
+
+    size_t posicion = 0;
+    while (posicion < tamano) {
+        const void *salto = std::memchr(datos + posicion, '\n', tamano - posicion);
+        size_t finLinea = salto ? static_cast<const char *>(salto) - datos : tamano;
+        std::string_view linea(datos + posicion, finLinea - posicion);
+        posicion = finLinea + 1;
+        estadisticas.lineas++;
+
+        if (!linea.empty() && linea.back() == '\r')
+            linea.remove_suffix(1);
+        if (linea.empty())
+            continue;
+
+        if (primeraLinea)
+            separador = detectarSeparador(linea);
+
+        // Los campos opcionales ausentes quedan vacíos.
+        int cantidad = dividirCampos(linea, separador, campos, MAXIMO_CAMPOS);
+        if (cantidad < camposEsperados || campos[0].empty()) {
+            // Un encabezado puede nombrar menos columnas que las esperadas.
+            if (primeraLinea && esEncabezado(campos, cantidad)) {
+                primeraLinea = false;
+                continue;
+            }
+            throw std::invalid_argument("Linea " + std::to_string(estadisticas.lineas) + ": faltan campos");
+        }
+        std::fill(campos + cantidad, campos + MAXIMO_CAMPOS, std::string_view());
+
+        if (procesar(campos)) {
+            estadisticas.registros++;
+        } else if (!primeraLinea) {
+            throw std::invalid_argument("Linea " + std::to_string(estadisticas.lineas) + ": valor numerico invalido");
+        }
+        primeraLinea = false;
+
+        if (posicion >= siguienteLiberacion) {
+            archivo.liberarHasta(posicion);
+            if (progreso) progreso(posicion, tamano);
+            siguienteLiberacion = posicion + BLOQUE_PROGRESO;
+        }
+    }
+
+    if (progreso) progreso(tamano, tamano);
+    estadisticas.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return estadisticas;
+}
+
+template<typename T>
+EstadisticasImportacion ImportadorCSV<T>::importarVertices(const std::string &ruta) {
+    return recorrer(ruta, 3, [this](const std::string_view *campos) {
+        double latitud, longitud;
+        if (!leerNumero(campos[1], latitud) || !leerNumero(campos[2], longitud))
+            return false;
+        coordenadas[obtenerVertice(campos[0])] = Coordenada(latitud, longitud);
+        return true;
+    });
+}
+
+template<typename T>
+EstadisticasImportacion ImportadorCSV<T>::importarAristas(const std::string &ruta) {
+    return recorrer(ruta, 4, [this](const std::string_view *campos) {
+        double distancia, tiempo;
+        if (!leerNumero(campos[2], distancia) || !leerNumero(campos[3], tiempo) || campos[1].empty())
+            return false;
+        double capacidad = AdyacenteConPeso::SIN_CAPACIDAD;
+        // La capacidad es entera: "12.7" se rechaza en lugar de truncarse.
+        if (!campos[4].empty() && (!leerNumero(campos[4], capacidad) || capacidad < 0 ||
+                                   capacidad >= AdyacenteConPeso::SIN_CAPACIDAD || capacidad != std::trunc(capacidad)))
+            return false;
+        int nroOrigen = obtenerVertice(campos[0]);
+        int nroDestino = obtenerVertice(campos[1]);
+        builder.agregarArista(nroOrigen, nroDestino, distancia, tiempo, static_cast<uint32_t>(capacidad));
+        return true;
+    });
+}
+
+template<typename T>
+const std::vector<Coordenada> &ImportadorCSV<T>::getCoordenadas() const {
+    return coordenadas;
+}
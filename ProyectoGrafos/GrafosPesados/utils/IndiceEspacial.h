@@ -0,0 +1,63 @@
+#ifndef INDICEESPACIAL_H
+#define INDICEESPACIAL_H
+#include <functional>
+#include <vector>
+
+#include "ArbolKD.h"
+#include "../Coordenada.h"
+#include "../GrafoPesado.h"
+
+// Índice de vecinos más cercanos sobre las coordenadas de los vértices de un grafo.
+// Observa el grafo: un vértice insertado se ubica con 'ubicar' (si se dio) y uno
+// eliminado sale del índice, respetando la renumeración cuando no hay ids estables.
+// Tras una carga masiva las coordenadas sólo se recuperan con 'ubicar'.
+template<typename T>
+class IndiceEspacial : public ObservadorGrafo<T> {
+public:
+    using Ubicador = std::function<Coordenada(const T &vertice)>;
+
+private:
+    GrafoPesado<T> &grafo;
+    Ubicador ubicar;
+    std::vector<Coordenada> coordenadas;
+    ArbolKD arbol;
+
+    void ubicarTodos();
+
+public:
+    // 'coordenadas' está indexado por número de vértice, como en ImportadorCSV.
+    IndiceEspacial(GrafoPesado<T> &grafo, std::vector<Coordenada> coordenadas, Ubicador ubicar = nullptr);
+
+    explicit IndiceEspacial(GrafoPesado<T> &grafo, Ubicador ubicar);
+
+    ~IndiceEspacial() override;
+
+    IndiceEspacial(const IndiceEspacial &) = delete;
+
+    IndiceEspacial &operator=(const IndiceEspacial &) = delete;
+
+    const GrafoPesado<T> &getGrafo() const { return grafo; }
+
+    // Coordenada no válida para quitar el vértice del índice.
+    void setCoordenada(int nroVertice, const Coordenada &coordenada);
+
+    Coordenada getCoordenada(int nroVertice) const;
+
+    // Indexado por número de vértice; sirve de heurística para buscarAEstrella.
+    const std::vector<Coordenada> &getCoordenadas() const { return coordenadas; }
+
+    int cantidadUbicados() const { return arbol.cantidad(); }
+
+    std::vector<VecinoCercano> masCercanos(const Coordenada &punto, int cantidad) const;
+
+    std::vector<VecinoCercano> dentroDeRadio(const Coordenada &punto, double kilometros) const;
+
+    void verticeInsertado(const T &vertice, int nroVertice) override;
+
+    void verticeEliminado(const T &vertice, int nroVertice) override;
+
+    void grafoReemplazado() override;
+};
+
+#endif //INDICEESPACIAL_H
+#include "IndiceEspacial.tpp"
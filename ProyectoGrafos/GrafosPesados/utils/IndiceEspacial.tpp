@@ -0,0 +1,85 @@
+#pragma once
+#include <stdexcept>
+
+template<typename T>
+IndiceEspacial<T>::IndiceEspacial(GrafoPesado<T> &grafo, std::vector<Coordenada> coordenadas, Ubicador ubicar)
+    : grafo(grafo), ubicar(std::move(ubicar)), coordenadas(std::move(coordenadas)) {
+    if (static_cast<int>(this->coordenadas.size()) > grafo.cantidadVertices())
+        throw std::invalid_argument("Hay mas coordenadas que vertices");
+    this->coordenadas.resize(grafo.cantidadVertices());
+    for (int v = 0; v < grafo.cantidadVertices(); v++)
+        if (grafo.estaEliminado(v)) this->coordenadas[v] = Coordenada();
+    arbol.cargar(this->coordenadas);
+    grafo.agregarObservador(this);
+}
+
+template<typename T>
+IndiceEspacial<T>::IndiceEspacial(GrafoPesado<T> &grafo, Ubicador ubicar)
+    : grafo(grafo), ubicar(std::move(ubicar)) {
+    ubicarTodos();
+    grafo.agregarObservador(this);
+}
+
+template<typename T>
+IndiceEspacial<T>::~IndiceEspacial() {
+    grafo.quitarObservador(this);
+}
+
+template<typename T>
+void IndiceEspacial<T>::ubicarTodos() {
+    coordenadas.assign(grafo.cantidadVertices(), Coordenada());
+    if (ubicar) {
+        for (int v = 0; v < grafo.cantidadVertices(); v++)
+            if (!grafo.estaEliminado(v)) coordenadas[v] = ubicar(grafo.getVertice(v));
+    }
+    arbol.cargar(coordenadas);
+}
+
+template<typename T>
+void IndiceEspacial<T>::setCoordenada(int nroVertice, const Coordenada &coordenada) {
+    if (nroVertice < 0 || nroVertice >= grafo.cantidadVertices() || grafo.estaEliminado(nroVertice))
+        throw std::invalid_argument("Vertice invalido");
+    coordenadas[nroVertice] = coordenada;
+    arbol.insertar(nroVertice, coordenada);
+}
+
+template<typename T>
+Coordenada IndiceEspacial<T>::getCoordenada(int nroVertice) const {
+    return nroVertice >= 0 && nroVertice < static_cast<int>(coordenadas.size()) ? coordenadas[nroVertice]
+                                                                                  : Coordenada();
+}
+
+template<typename T>
+std::vector<VecinoCercano> IndiceEspacial<T>::masCercanos(const Coordenada &punto, int cantidad) const {
+    return arbol.masCercanos(punto, cantidad);
+}
+
+template<typename T>
+std::vector<VecinoCercano> IndiceEspacial<T>::dentroDeRadio(const Coordenada &punto, double kilometros) const {
+    return arbol.dentroDeRadio(punto, kilometros);
+}
+
+template<typename T>
+void IndiceEspacial<T>::verticeInsertado(const T &vertice, int nroVertice) {
+    // Con ids estables el número puede ser una posición liberada.
+    if (nroVertice >= static_cast<int>(coordenadas.size()))
+        coordenadas.resize(nroVertice + 1);
+    coordenadas[nroVertice] = ubicar ? ubicar(vertice) : Coordenada();
+    arbol.insertar(nroVertice, coordenadas[nroVertice]);
+}
+
+template<typename T>
+void IndiceEspacial<T>::verticeEliminado(const T &vertice, int nroVertice) {
+    if (grafo.tieneIdsEstables()) {
+        coordenadas[nroVertice] = Coordenada();
+        arbol.quitar(nroVertice);
+    } else {
+        coordenadas.erase(coordenadas.begin() + nroVertice);
+        arbol.quitarYRenumerar(nroVertice);
+    }
+}
+
+template<typename T>
+void IndiceEspacial<T>::grafoReemplazado() {
+    ubicarTodos();
+}
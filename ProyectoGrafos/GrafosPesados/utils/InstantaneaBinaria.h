@@ -0,0 +1,52 @@
+#ifndef INSTANTANEABINARIA_H
+#define INSTANTANEABINARIA_H
+#include <cstdint>
+#include <string>
+
+#include "ArchivoMapeado.h"
+#include "../GrafoCompacto.h"
+
+// Formato binario versionado para cargar un grafo sin parsear texto:
+//   cabecera | desplazamientos de nombres (n+1 x u64) | bytes de nombres (UTF-8)
+//   | desplazamientos CSR (n+1 x i32) | arcos (m x ArcoDisco)
+// Cada sección empieza alineada a 8 bytes. La carga proyecta el archivo con mmap,
+// valida los desplazamientos y destinos y copia las secciones en bloque a un
+// GrafoCompacto, sin decodificar arista por arista; volcarlo en un GrafoPesado es
+// una segunda copia, así que la carga no es de cero copias.
+// Versión 2: el campo de relleno de cada arco guarda su capacidad; los archivos de la
+// versión 1 se siguen leyendo y sus arcos quedan sin capacidad.
+template<typename T>
+class InstantaneaBinaria {
+public:
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint32_t MARCA_ENDIAN = 0x01020304;
+    static constexpr uint32_t BANDERA_DIRIGIDO = 1;
+
+    struct Cabecera {
+        char magia[4];
+        uint32_t version;
+        uint32_t marcaEndian;
+        uint32_t banderas;
+        uint64_t cantidadVertices;
+        uint64_t cantidadArcos;
+        uint64_t bytesNombres;
+        uint64_t secuencia; // última mutación registrada incluida en la instantánea
+    };
+
+    struct ArcoDisco {
+        int32_t destino;
+        uint32_t capacidad; // reservado (0) en la versión 1
+        double distancia;
+        double tiempo;
+    };
+
+    static void guardar(const GrafoCompacto<T> &grafo, const std::string &ruta, uint64_t secuencia = 0);
+
+    static GrafoCompacto<T> cargar(const std::string &ruta, uint64_t *secuencia = nullptr);
+
+private:
+    static size_t alinear(size_t bytes) { return (bytes + 7) & ~static_cast<size_t>(7); }
+};
+
+#endif
+#include "InstantaneaBinaria.tpp"
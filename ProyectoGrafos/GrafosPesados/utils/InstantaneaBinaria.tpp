@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+template<typename T>
+void InstantaneaBinaria<T>::guardar(const GrafoCompacto<T> &grafo, const std::string &ruta, uint64_t secuencia) {
+    const uint64_t n = grafo.cantidadVertices();
+    const uint64_t m = grafo.cantidadArcos();
+
+    std::vector<std::string> nombres;
+    nombres.reserve(n);
+    std::vector<uint64_t> desplazamientosNombres(n + 1, 0);
+    for (uint64_t v = 0; v < n; v++) {
+        nombres.push_back(grafo.getVertice(v).toStdString());
+        desplazamientosNombres[v + 1] = desplazamientosNombres[v] + nombres.back().size();
+    }
+
+    Cabecera cabecera{};
+    std::memcpy(cabecera.magia, "GRFP", 4);
+    cabecera.version = VERSION;
+    cabecera.marcaEndian = MARCA_ENDIAN;
+    cabecera.banderas = grafo.esDirigido() ? BANDERA_DIRIGIDO : 0;
+    cabecera.cantidadVertices = n;
+    cabecera.cantidadArcos = m;
+    cabecera.bytesNombres = desplazamientosNombres[n];
+    cabecera.secuencia = secuencia;
+
+    // Se escribe en un archivo temporal y se renombra para no dejar instantáneas a medias.
+    const std::string rutaTemporal = ruta + ".tmp";
+    std::ofstream salida(rutaTemporal, std::ios::binary | std::ios::trunc);
+    if (!salida)
+        throw std::runtime_error("No se pudo crear el archivo: " + ruta);
+
+    const char relleno[8] = {};
+    auto escribir = [&salida, &relleno](const void *datos, size_t bytes) {
+        salida.write(static_cast<const char *>(datos), bytes);
+        salida.write(relleno, alinear(bytes) - bytes);
+    };
+
+    escribir(&cabecera, sizeof(cabecera));
+    escribir(desplazamientosNombres.data(), desplazamientosNombres.size() * sizeof(uint64_t));
+    for (const auto &nombre: nombres)
+        salida.write(nombre.data(), nombre.size());
+    salida.write(relleno, alinear(cabecera.bytesNombres) - cabecera.bytesNombres);
+
+    static_assert(sizeof(int) == sizeof(int32_t));
+    escribir(grafo.getDesplazamientos().data(), (n + 1) * sizeof(int32_t));
+
+    std::vector<ArcoDisco> bloque;
+    bloque.reserve(std::min<uint64_t>(m, 1 << 16));
+    for (const auto &arco: grafo.getArcos()) {
+        bloque.push_back({arco.indiceVertice, arco.capacidad, arco.distancia, arco.tiempo});
+        if (bloque.size() == bloque.capacity()) {
+            salida.write(reinterpret_cast<const char *>(bloque.data()), bloque.size() * sizeof(ArcoDisco));
+            bloque.clear();
+        }
+    }
+    salida.write(reinterpret_cast<const char *>(bloque.data()), bloque.size() * sizeof(ArcoDisco));
+
+    salida.close();
+    if (!salida)
+        throw std::runtime_error("No se pudo escribir el archivo: " + ruta);
+    reemplazarArchivo(rutaTemporal, ruta);
+}
+
+template<typename T>
+GrafoCompacto<T> InstantaneaBinaria<T>::cargar(const std::string &ruta, uint64_t *secuencia) {
+    ArchivoMapeado archivo(ruta);
+    const char *datos = archivo.getDatos();
+    const size_t tamano = archivo.getTamano();
+
+    Cabecera cabecera{};
+    if (tamano < sizeof(Cabecera))
+        throw std::invalid_argument("Instantanea truncada: " + ruta);
+    std::memcpy(&cabecera, datos, sizeof(Cabecera));
+
+    if (std::memcmp(cabecera.magia, "GRFP", 4) != 0)
+        throw std::invalid_argument("El archivo no es una instantanea de grafo: " + ruta);
+    if (cabecera.marcaEndian != MARCA_ENDIAN)
+        throw std::invalid_argument("Instantanea con orden de bytes incompatible");
+    if (cabecera.version < 1 || cabecera.version > VERSION)
+        throw std::invalid_argument("Version de instantanea no soportada: " + std::to_string(cabecera.version));
+
+    const uint64_t n = cabecera.cantidadVertices;
+    const uint64_t m = cabecera.cantidadArcos;
+    if (n >= static_cast<uint64_t>(INT32_MAX) || m >= static_cast<uint64_t>(INT32_MAX) ||
+        cabecera.bytesNombres > tamano)
+        throw std::invalid_argument("Instantanea truncada: " + ruta);
+
+    // Cada sección se acota contra lo que queda del archivo antes de sumarla, así un
+    // tamaño corrupto en la cabecera no puede desbordar los desplazamientos.
+    size_t posicion = alinear(sizeof(Cabecera));
+    auto seccion = [&](uint64_t cantidad, size_t bytesElemento) {
+        if (posicion > tamano || cantidad > (tamano - posicion) / bytesElemento)
+            throw std::invalid_argument("Instantanea truncada: " + ruta);
+        size_t inicio = posicion;
+        posicion += alinear(cantidad * bytesElemento);
+        return inicio;
+    };
+    const size_t inicioNombres = seccion(n + 1, sizeof(uint64_t));
+    const size_t inicioBytes = seccion(cabecera.bytesNombres, 1);
+    const size_t inicioCSR = seccion(n + 1, sizeof(int32_t));
+    const size_t inicioArcos = seccion(m, sizeof(ArcoDisco));
+
+    std::vector<uint64_t> desplazamientosNombres(n + 1);
+    std::memcpy(desplazamientosNombres.data(), datos + inicioNombres, (n + 1) * sizeof(uint64_t));
+    std::vector<T> vertices;
+    vertices.reserve(n);
+    for (uint64_t v = 0; v < n; v++) {
+        uint64_t desde = desplazamientosNombres[v];
+        uint64_t hasta = desplazamientosNombres[v + 1];
+        if (desde > hasta || hasta > cabecera.bytesNombres || (v == 0 && desde != 0))
+            throw std::invalid_argument("Tabla de nombres corrupta");
+        vertices.push_back(T::fromStdString(std::string(datos + inicioBytes + desde, hasta - desde)));
+    }
+
+    std::vector<int> desplazamientos(n + 1);
+    std::memcpy(desplazamientos.data(), datos + inicioCSR, (n + 1) * sizeof(int32_t));
+    if (desplazamientos[0] != 0 || static_cast<uint64_t>(desplazamientos[n]) != m)
+        throw std::invalid_argument("Desplazamientos CSR inconsistentes");
+    for (uint64_t v = 0; v < n; v++)
+        if (desplazamientos[v] > desplazamientos[v + 1])
+            throw std::invalid_argument("Desplazamientos CSR inconsistentes");
+
+    // ArcoDisco y AdyacenteConPeso comparten disposición, así que los arcos se copian en bloque.
+    static_assert(std::is_trivially_copyable_v<AdyacenteConPeso>);
+    static_assert(sizeof(AdyacenteConPeso) == sizeof(ArcoDisco) &&
+                  offsetof(AdyacenteConPeso, indiceVertice) == offsetof(ArcoDisco, destino) &&
+                  offsetof(AdyacenteConPeso, capacidad) == offsetof(ArcoDisco, capacidad) &&
+                  offsetof(AdyacenteConPeso, distancia) == offsetof(ArcoDisco, distancia) &&
+                  offsetof(AdyacenteConPeso, tiempo) == offsetof(ArcoDisco, tiempo));
+    const auto *arcosMapeados = reinterpret_cast<const AdyacenteConPeso *>(datos + inicioArcos);
+    std::vector<AdyacenteConPeso> arcos(arcosMapeados, arcosMapeados + m);
+    for (auto &arco: arcos) {
+        if (arco.indiceVertice < 0 || static_cast<uint64_t>(arco.indiceVertice) >= n)
+            throw std::invalid_argument("Arco con vertice fuera de rango");
+        if (cabecera.version == 1)
+            arco.capacidad = AdyacenteConPeso::SIN_CAPACIDAD;
+    }
+
+    if (secuencia != nullptr)
+        *secuencia = cabecera.secuencia;
+    return GrafoCompacto<T>(std::move(vertices), std::move(desplazamientos), std::move(arcos),
+                            (cabecera.banderas & BANDERA_DIRIGIDO) != 0);
+}
@@ -0,0 +1,40 @@
+#ifndef INTERMEDIACION_H
+#define INTERMEDIACION_H
+#include <string>
+#include <vector>
+
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+
+// Centralidad de intermediación: cuántos caminos mínimos pasan por cada vértice y arco.
+struct ResultadoIntermediacion {
+    std::vector<double> vertices;
+    // Un valor por arco, en el orden de adyacentesDe(v) a partir de desplazamientos[v].
+    // En grafos no dirigidos los dos arcos de una arista llevan el valor de la arista.
+    std::vector<double> arcos;
+    std::vector<int> desplazamientos;
+    // Cantidad de orígenes usados; menor que la de vértices si fue una aproximación.
+    int pivotes = 0;
+    double segundos = 0;
+
+    double deArco(int nroOrigen, int posicion) const {
+        return arcos[desplazamientos[nroOrigen] + posicion];
+    }
+};
+
+// Brandes con Dijkstra: cada origen cuenta sus caminos mínimos (sigma) y acumula las
+// dependencias en orden inverso de cierre. Los orígenes se reparten entre hilos y
+// cada hilo suma en sus propios acumuladores, que se combinan al final.
+// Con pivotes > 0 se usan esa cantidad de orígenes al azar y el resultado se escala
+// por n / pivotes (estimador insesgado); con 0 el cálculo es exacto.
+template<typename Grafo, typename Politica = PesoDistancia>
+ResultadoIntermediacion intermediacion(const Grafo &grafo, int pivotes = 0, Politica peso = Politica(),
+                                       int hilos = cantidadHilos(), unsigned semilla = 1);
+
+// Escribe dos CSV: "vertice,intermediacion" y "origen,destino,intermediacion".
+template<typename Grafo>
+void exportarIntermediacionCSV(const Grafo &grafo, const ResultadoIntermediacion &resultado,
+                               const std::string &rutaVertices, const std::string &rutaArcos);
+
+#endif //INTERMEDIACION_H
+#include "Intermediacion.tpp"
@@ -0,0 +1,203 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "Componentes.h"
+
+template<typename Grafo, typename Politica>
+ResultadoIntermediacion intermediacion(const Grafo &grafo, int pivotes, Politica peso, int hilos, unsigned semilla) {
+    auto inicio = std::chrono::steady_clock::now();
+    const int n = grafo.cantidadVertices();
+    hilos = std::max(1, hilos);
+
+    ResultadoIntermediacion resultado;
+    resultado.desplazamientos.assign(n + 1, 0);
+    for (int v = 0; v < n; v++)
+        resultado.desplazamientos[v + 1] = resultado.desplazamientos[v] + grafo.adyacentesDe(v).size();
+    const int m = resultado.desplazamientos[n];
+
+    std::vector<int> origenes;
+    for (int v = 0; v < n; v++)
+        if (esVerticeActivo(grafo, v)) origenes.push_back(v);
+    const int activos = origenes.size();
+    if (pivotes > 0 && pivotes < activos) {
+        std::mt19937 generador(semilla);
+        std::shuffle(origenes.begin(), origenes.end(), generador);
+        origenes.resize(pivotes);
+    }
+    resultado.pivotes = origenes.size();
+
+    struct Acumulador {
+        EspacioConsulta espacio;
+        std::vector<double> caminos;
+        std::vector<double> dependencia;
+        std::vector<int> cerrados;
+        std::vector<double> vertices;
+        std::vector<double> arcos;
+        // Arcos del DAG de caminos mínimos: de un vértice cerrado a uno aún abierto.
+        std::vector<char> enDag;
+    };
+    std::vector<Acumulador> acumuladores(hilos);
+    for (auto &acumulador: acumuladores) {
+        acumulador.caminos.assign(n, 0);
+        acumulador.dependencia.assign(n, 0);
+        acumulador.vertices.assign(n, 0);
+        acumulador.arcos.assign(m, 0);
+        acumulador.enDag.assign(m, 0);
+    }
+
+    paraCadaIndice(origenes.size(), hilos, [&](size_t i, int idHilo) {
+        Acumulador &acumulador = acumuladores[idHilo];
+        EspacioConsulta &espacio = acumulador.espacio;
+        auto &caminos = acumulador.caminos;
+        auto &dependencia = acumulador.dependencia;
+        auto &cerrados = acumulador.cerrados;
+        auto &enDag = acumulador.enDag;
+        const int origen = origenes[i];
+
+        // Dijkstra que además cuenta los caminos mínimos: un empate suma, una mejora reemplaza.
+        espacio.preparar(n);
+        cerrados.clear();
+        espacio.relajar(origen, 0, EspacioConsulta::SIN_PREDECESOR);
+        caminos[origen] = 1;
+        espacio.insertarEnMonticulo(0, origen);
+        while (!espacio.monticuloVacio()) {
+            auto [costo, vertice] = espacio.extraerMinimo();
+            if (espacio.estaCerrado(vertice)) continue;
+            espacio.cerrar(vertice);
+            cerrados.push_back(vertice);
+            auto adyacentes = grafo.adyacentesDe(vertice);
+            for (size_t j = 0; j < adyacentes.size(); j++) {
+                int vecino = adyacentes[j].indiceVertice;
+                if (espacio.estaCerrado(vecino)) continue;
+                double nuevoCosto = costo + peso(adyacentes[j]);
+                double actual = espacio.getCosto(vecino);
+                if (nuevoCosto < actual) {
+                    espacio.relajar(vecino, nuevoCosto, vertice);
+                    caminos[vecino] = caminos[vertice];
+                    espacio.insertarEnMonticulo(nuevoCosto, vecino);
+                } else if (nuevoCosto == actual) {
+                    caminos[vecino] += caminos[vertice];
+                } else {
+                    continue;
+                }
+                enDag[resultado.desplazamientos[vertice] + j] = 1;
+            }
+        }
+
+        // Acumulación en orden inverso: los sucesores en el DAG de caminos mínimos ya
+        // tienen su dependencia completa cuando se procesa cada vértice. Sólo cuentan los
+        // arcos marcados al relajar: con aristas de peso 0, comparar costos aceptaría arcos
+        // entre vértices de igual costo que no aportaron a 'caminos'. Un arco marcado
+        // cuyo destino mejoró después ya no cumple la igualdad de costos.
+        for (auto it = cerrados.rbegin(); it != cerrados.rend(); ++it) {
+            const int vertice = *it;
+            const double costo = espacio.getCosto(vertice);
+            double propia = 0;
+            auto adyacentes = grafo.adyacentesDe(vertice);
+            for (size_t j = 0; j < adyacentes.size(); j++) {
+                char &marcado = enDag[resultado.desplazamientos[vertice] + j];
+                const bool delDag = marcado;
+                marcado = 0;
+                int vecino = adyacentes[j].indiceVertice;
+                if (!delDag || espacio.getCosto(vecino) != costo + peso(adyacentes[j])) continue;
+                double aporte = caminos[vertice] / caminos[vecino] * (1 + dependencia[vecino]);
+                acumulador.arcos[resultado.desplazamientos[vertice] + j] += aporte;
+                propia += aporte;
+            }
+            dependencia[vertice] = propia;
+            if (vertice != origen)
+                acumulador.vertices[vertice] += propia;
+        }
+
+        for (int vertice: espacio.getTocados()) {
+            caminos[vertice] = 0;
+            dependencia[vertice] = 0;
+        }
+    }, 1);
+
+    // En no dirigidos cada par se contó desde sus dos extremos.
+    const double escala = (resultado.pivotes > 0 ? static_cast<double>(activos) / resultado.pivotes : 0) *
+                          (grafo.esDirigido() ? 1.0 : 0.5);
+    resultado.vertices.assign(n, 0);
+    resultado.arcos.assign(m, 0);
+    paraCadaIndice(std::max(n, m), hilos, [&](size_t i, int) {
+        for (const auto &acumulador: acumuladores) {
+            if (i < static_cast<size_t>(n)) resultado.vertices[i] += acumulador.vertices[i];
+            if (i < static_cast<size_t>(m)) resultado.arcos[i] += acumulador.arcos[i];
+        }
+        if (i < static_cast<size_t>(n)) resultado.vertices[i] *= escala;
+        if (i < static_cast<size_t>(m)) resultado.arcos[i] *= escala;
+    }, 4096);
+
+    if (!grafo.esDirigido()) {
+        // Arco u->v y v->u son la misma arista: ambos llevan la suma.
+        std::vector<double> porArista(m);
+        for (int v = 0; v < n; v++) {
+            auto adyacentes = grafo.adyacentesDe(v);
+            for (size_t j = 0; j < adyacentes.size(); j++) {
+                int vecino = adyacentes[j].indiceVertice;
+                double total = resultado.arcos[resultado.desplazamientos[v] + j];
+                auto inversos = grafo.adyacentesDe(vecino);
+                for (size_t k = 0; k < inversos.size() && vecino != v; k++)
+                    if (inversos[k].indiceVertice == v) {
+                        total += resultado.arcos[resultado.desplazamientos[vecino] + k];
+                        break;
+                    }
+                porArista[resultado.desplazamientos[v] + j] = total;
+            }
+        }
+        resultado.arcos = std::move(porArista);
+    }
+
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
+
+inline std::string campoCSV(const std::string &texto) {
+    if (texto.find_first_of(",;\t\"\r\n") == std::string::npos)
+        return texto;
+    // RFC 4180: las comillas internas se duplican.
+    std::string escapado = "\"";
+    for (char c: texto) {
+        if (c == '"') escapado += '"';
+        escapado += c;
+    }
+    return escapado + "\"";
+}
+
+template<typename Grafo>
+void exportarIntermediacionCSV(const Grafo &grafo, const ResultadoIntermediacion &resultado,
+                               const std::string &rutaVertices, const std::string &rutaArcos) {
+    const int n = grafo.cantidadVertices();
+    if (static_cast<int>(resultado.vertices.size()) != n)
+        throw std::invalid_argument("El resultado no corresponde al grafo");
+
+    std::ofstream vertices(rutaVertices);
+    if (!vertices)
+        throw std::runtime_error("No se pudo crear el archivo: " + rutaVertices);
+    vertices << "vertice,intermediacion\n";
+    for (int v = 0; v < n; v++)
+        if (esVerticeActivo(grafo, v))
+            vertices << campoCSV(grafo.getVertice(v).toStdString()) << ',' << resultado.vertices[v] << '\n';
+
+    std::ofstream arcos(rutaArcos);
+    if (!arcos)
+        throw std::runtime_error("No se pudo crear el archivo: " + rutaArcos);
+    arcos << "origen,destino,intermediacion\n";
+    for (int v = 0; v < n; v++) {
+        auto adyacentes = grafo.adyacentesDe(v);
+        for (size_t j = 0; j < adyacentes.size(); j++) {
+            int vecino = adyacentes[j].indiceVertice;
+            if (!grafo.esDirigido() && vecino < v) continue;
+            arcos << campoCSV(grafo.getVertice(v).toStdString()) << ','
+                  << campoCSV(grafo.getVertice(vecino).toStdString()) << ',' << resultado.deArco(v, j) << '\n';
+        }
+    }
+    if (!vertices || !arcos)
+        throw std::runtime_error("No se pudo escribir la intermediacion");
+}
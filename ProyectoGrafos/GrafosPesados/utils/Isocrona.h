@@ -0,0 +1,32 @@
+#ifndef ISOCRONA_H
+#define ISOCRONA_H
+#include <span>
+#include <vector>
+
+#include "../BusquedaCaminos.h"
+
+struct VerticeAlcanzado {
+    int vertice;
+    double costo;
+    // Vértice anterior en el camino mínimo; SIN_PREDECESOR para los orígenes.
+    int predecesor;
+};
+
+// Vértices alcanzables con costo <= presupuesto, ordenados por costo. La búsqueda
+// poda toda relajación que excede el presupuesto y usa un EspacioConsulta, así que
+// el trabajo es proporcional a lo visitado y no a la cantidad de vértices del grafo.
+template<typename Grafo, typename Politica = PesoDistancia, typename Filtro = SinFiltro>
+std::vector<VerticeAlcanzado> alcanzablesDentroDe(const Grafo &grafo, int origen, double presupuesto,
+                                                  Politica peso = Politica(),
+                                                  EspacioConsulta &espacio = EspacioConsulta::delHilo(),
+                                                  const Filtro &filtro = Filtro());
+
+// Alcanzables desde cualquiera de los orígenes; el costo es al origen más cercano.
+template<typename Grafo, typename Politica = PesoDistancia, typename Filtro = SinFiltro>
+std::vector<VerticeAlcanzado> alcanzablesDentroDe(const Grafo &grafo, std::span<const int> origenes,
+                                                  double presupuesto, Politica peso = Politica(),
+                                                  EspacioConsulta &espacio = EspacioConsulta::delHilo(),
+                                                  const Filtro &filtro = Filtro());
+
+#endif //ISOCRONA_H
+#include "Isocrona.tpp"
@@ -0,0 +1,35 @@
+#pragma once
+
+// Junta los vértices en el orden en que se cierran, que ya es creciente por costo.
+class RecolectorAlcanzados : public VisitanteNulo {
+private:
+    const EspacioConsulta &espacio;
+    std::vector<VerticeAlcanzado> &alcanzados;
+
+public:
+    RecolectorAlcanzados(const EspacioConsulta &espacio, std::vector<VerticeAlcanzado> &alcanzados)
+        : espacio(espacio), alcanzados(alcanzados) {
+    }
+
+    void verticeCerrado(int vertice, double costo) {
+        alcanzados.push_back({vertice, costo, espacio.getPredecesor(vertice)});
+    }
+};
+
+template<typename Grafo, typename Politica, typename Filtro>
+std::vector<VerticeAlcanzado> alcanzablesDentroDe(const Grafo &grafo, std::span<const int> origenes,
+                                                  double presupuesto, Politica peso, EspacioConsulta &espacio,
+                                                  const Filtro &filtro) {
+    std::vector<VerticeAlcanzado> alcanzados;
+    if (presupuesto < 0)
+        return alcanzados;
+    RecolectorAlcanzados recolector(espacio, alcanzados);
+    buscarCaminos(grafo, origenes, espacio, peso, ParadaPorPresupuesto(presupuesto), recolector, filtro);
+    return alcanzados;
+}
+
+template<typename Grafo, typename Politica, typename Filtro>
+std::vector<VerticeAlcanzado> alcanzablesDentroDe(const Grafo &grafo, int origen, double presupuesto,
+                                                  Politica peso, EspacioConsulta &espacio, const Filtro &filtro) {
+    return alcanzablesDentroDe(grafo, std::span<const int>(&origen, 1), presupuesto, peso, espacio, filtro);
+}
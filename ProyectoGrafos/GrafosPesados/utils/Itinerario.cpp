@@ -0,0 +1,202 @@
+#include "Itinerario.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+
+struct MovimientoLocal {
+    double delta = 0;
+    // 0: 2-opt invierte las posiciones i..j; 1: Or-opt lleva i..i+largo-1 detrás de la posición j.
+    int tipo = -1;
+    int i = 0;
+    int j = 0;
+    int largo = 0;
+
+    // El desempate por posición hace que el resultado no dependa de la cantidad de hilos.
+    bool mejorQue(const MovimientoLocal &otro) const {
+        if (delta != otro.delta) return delta < otro.delta;
+        return std::tie(tipo, i, j, largo) < std::tie(otro.tipo, otro.i, otro.j, otro.largo);
+    }
+};
+
+static double costoRecorrido(const std::vector<double> &costos, int n, const std::vector<int> &recorrido) {
+    double total = 0;
+    for (int p = 0; p < n; p++)
+        total += costos[static_cast<size_t>(recorrido[p]) * n + recorrido[(p + 1) % n]];
+    return total;
+}
+
+std::vector<int> recorridoVecinoMasCercano(const std::vector<double> &costos, int n, int ultimo) {
+    std::vector<int> recorrido;
+    if (n == 0)
+        return recorrido;
+    recorrido.reserve(n);
+    std::vector<char> visitado(n, 0);
+    recorrido.push_back(0);
+    visitado[0] = 1;
+    if (ultimo > 0)
+        visitado[ultimo] = 1;
+
+    int libres = ultimo > 0 ? n - 1 : n;
+    while (static_cast<int>(recorrido.size()) < libres) {
+        int actual = recorrido.back();
+        int siguiente = -1;
+        double mejor = std::numeric_limits<double>::infinity();
+        for (int j = 0; j < n; j++) {
+            double costo = costos[static_cast<size_t>(actual) * n + j];
+            if (!visitado[j] && costo < mejor) {
+                mejor = costo;
+                siguiente = j;
+            }
+        }
+        recorrido.push_back(siguiente);
+        visitado[siguiente] = 1;
+    }
+    if (ultimo > 0)
+        recorrido.push_back(ultimo);
+    return recorrido;
+}
+
+std::vector<int> recorridoHeldKarp(const std::vector<double> &costos, int n, int hilos) {
+    if (n <= 1)
+        return std::vector<int>(n, 0);
+    auto costo = [&](int i, int j) { return costos[static_cast<size_t>(i) * n + j]; };
+
+    // mejor[mascara * m + k]: camino más corto desde 0 que visita 'mascara' y termina en k + 1.
+    const int m = n - 1;
+    const uint32_t estados = 1u << m;
+    std::vector<double> mejor(static_cast<size_t>(estados) * m, EspacioConsulta::INFINITO);
+    std::vector<std::vector<uint32_t> > capas(m + 1);
+    for (uint32_t mascara = 1; mascara < estados; mascara++)
+        capas[std::popcount(mascara)].push_back(mascara);
+    for (int k = 0; k < m; k++)
+        mejor[(static_cast<size_t>(1) << k) * m + k] = costo(0, k + 1);
+
+    // Una máscara sólo lee estados de la capa anterior y escribe su propia fila.
+    for (int tamano = 2; tamano <= m; tamano++) {
+        const auto &capa = capas[tamano];
+        paraCadaIndice(capa.size(), hilos, [&](size_t indice, int) {
+            uint32_t mascara = capa[indice];
+            for (int k = 0; k < m; k++) {
+                if (!(mascara >> k & 1)) continue;
+                uint32_t previa = mascara ^ (1u << k);
+                double valor = EspacioConsulta::INFINITO;
+                for (int j = 0; j < m; j++) {
+                    if (previa >> j & 1)
+                        valor = std::min(valor, mejor[static_cast<size_t>(previa) * m + j] + costo(j + 1, k + 1));
+                }
+                mejor[static_cast<size_t>(mascara) * m + k] = valor;
+            }
+        }, 256);
+    }
+
+    uint32_t mascara = estados - 1;
+    int ultimo = 0;
+    double total = std::numeric_limits<double>::infinity();
+    for (int k = 0; k < m; k++) {
+        double valor = mejor[static_cast<size_t>(mascara) * m + k] + costo(k + 1, 0);
+        if (valor < total) {
+            total = valor;
+            ultimo = k;
+        }
+    }
+
+    // Se reconstruye hacia atrás buscando el estado que produjo cada mínimo.
+    std::vector<int> recorrido(n, 0);
+    for (int posicion = n - 1; posicion >= 1; posicion--) {
+        recorrido[posicion] = ultimo + 1;
+        uint32_t previa = mascara ^ (1u << ultimo);
+        if (previa != 0) {
+            double objetivo = mejor[static_cast<size_t>(mascara) * m + ultimo];
+            int anterior = std::countr_zero(previa);
+            for (int j = 0; j < m; j++) {
+                if ((previa >> j & 1) &&
+                    mejor[static_cast<size_t>(previa) * m + j] + costo(j + 1, ultimo + 1) == objetivo) {
+                    anterior = j;
+                    break;
+                }
+            }
+            ultimo = anterior;
+        }
+        mascara = previa;
+    }
+    return recorrido;
+}
+
+std::vector<int> recorridoBusquedaLocal(const std::vector<double> &costos, int n, std::vector<int> recorrido,
+                                        int hilos, double maxSegundos, int &mejoras) {
+    mejoras = 0;
+    if (n <= 3)
+        return recorrido;
+    auto costo = [&](int i, int j) { return costos[static_cast<size_t>(i) * n + j]; };
+    auto inicio = std::chrono::steady_clock::now();
+    hilos = std::max(1, hilos);
+
+    // Sumas prefijas en ambos sentidos: el costo de un tramo invertido sale en O(1)
+    // aunque la matriz sea asimétrica.
+    std::vector<double> adelante(n + 1, 0), atras(n + 1, 0);
+    std::vector<MovimientoLocal> mejoresPorHilo(hilos);
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() < maxSegundos) {
+        for (int p = 0; p < n; p++) {
+            int a = recorrido[p], b = recorrido[(p + 1) % n];
+            adelante[p + 1] = adelante[p] + costo(a, b);
+            atras[p + 1] = atras[p] + costo(b, a);
+        }
+        double total = adelante[n];
+        std::fill(mejoresPorHilo.begin(), mejoresPorHilo.end(), MovimientoLocal());
+
+        // La posición 0 queda fija; cada hilo evalúa los movimientos que empiezan en i.
+        paraCadaIndice(n - 1, hilos, [&](size_t indice, int idHilo) {
+            MovimientoLocal &mejor = mejoresPorHilo[idHilo];
+            auto considerar = [&](const MovimientoLocal &candidato) {
+                if (candidato.mejorQue(mejor)) mejor = candidato;
+            };
+            int i = indice + 1;
+            int a = recorrido[i - 1], b = recorrido[i];
+            for (int j = i + 1; j < n; j++) {
+                int c = recorrido[j], d = recorrido[(j + 1) % n];
+                double delta = costo(a, c) + costo(b, d) - costo(a, b) - costo(c, d)
+                               + (atras[j] - atras[i]) - (adelante[j] - adelante[i]);
+                considerar({delta, 0, i, j, 0});
+            }
+            for (int largo = 1; largo <= 3 && i + largo <= n; largo++) {
+                int primero = recorrido[i], ultimo = recorrido[i + largo - 1];
+                int siguiente = recorrido[(i + largo) % n];
+                double quitar = costo(a, siguiente) - costo(a, primero) - costo(ultimo, siguiente);
+                for (int p = 0; p < n; p++) {
+                    if (p >= i - 1 && p <= i + largo - 1) continue;
+                    int x = recorrido[p], y = recorrido[(p + 1) % n];
+                    considerar({quitar + costo(x, primero) + costo(ultimo, y) - costo(x, y), 1, i, p, largo});
+                }
+            }
+        }, 4);
+
+        MovimientoLocal mejor;
+        for (const auto &candidato: mejoresPorHilo)
+            if (candidato.mejorQue(mejor)) mejor = candidato;
+        double umbral = 1e-9 * std::max(1.0, std::abs(total));
+        if (mejor.tipo < 0 || mejor.delta >= -umbral)
+            break;
+
+        std::vector<int> anterior = recorrido;
+        if (mejor.tipo == 0) {
+            std::reverse(recorrido.begin() + mejor.i, recorrido.begin() + mejor.j + 1);
+        } else {
+            std::vector<int> tramo(recorrido.begin() + mejor.i, recorrido.begin() + mejor.i + mejor.largo);
+            recorrido.erase(recorrido.begin() + mejor.i, recorrido.begin() + mejor.i + mejor.largo);
+            int destino = mejor.j > mejor.i ? mejor.j - mejor.largo : mejor.j;
+            recorrido.insert(recorrido.begin() + destino + 1, tramo.begin(), tramo.end());
+        }
+        // Con costos enormes (pares inalcanzables) el delta acumulado puede perder precisión.
+        if (costoRecorrido(costos, n, recorrido) >= total) {
+            recorrido = std::move(anterior);
+            break;
+        }
+        mejoras++;
+    }
+    return recorrido;
+}
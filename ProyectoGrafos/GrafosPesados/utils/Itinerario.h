@@ -0,0 +1,69 @@
+#ifndef ITINERARIO_H
+#define ITINERARIO_H
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+#include "../GrafoPesado.h"
+
+enum class MetodoItinerario {
+    EXACTO,
+    BUSQUEDA_LOCAL
+};
+
+struct OpcionesItinerario {
+    // Hasta esta cantidad de paradas se resuelve con Held-Karp: memoria 2^k * k costos,
+    // unos 170 MB con 20 paradas.
+    int maximoExacto = 20;
+    int hilos = cantidadHilos();
+    // Corte de la búsqueda local; se devuelve el mejor orden alcanzado.
+    double maxSegundos = 5;
+};
+
+template<typename T>
+struct ResultadoItinerario {
+    // Paradas en el orden de visita; vacío si alguna parada no es alcanzable.
+    std::vector<T> orden;
+    // Recorrido completo vértice a vértice, incluida la vuelta si es cerrado.
+    std::vector<T> camino;
+    double costo = EspacioConsulta::INFINITO;
+    bool cerrado = false;
+    MetodoItinerario metodo = MetodoItinerario::EXACTO;
+    int mejoras = 0;
+    double segundosMatriz = 0;
+    double segundosOrden = 0;
+
+    bool existe() const { return !orden.empty(); }
+};
+
+// Recorridos cerrados que empiezan en el nodo 0 sobre una matriz n x n de costos
+// (fila = origen). 'ultimo' >= 0 fija el nodo que cierra el recorrido.
+std::vector<int> recorridoVecinoMasCercano(const std::vector<double> &costos, int n, int ultimo = -1);
+
+std::vector<int> recorridoHeldKarp(const std::vector<double> &costos, int n, int hilos = cantidadHilos());
+
+// Mejora 'recorrido' hasta que ningún movimiento 2-opt u Or-opt lo acorta o se agota el tiempo.
+std::vector<int> recorridoBusquedaLocal(const std::vector<double> &costos, int n, std::vector<int> recorrido,
+                                        int hilos, double maxSegundos, int &mejoras);
+
+// Orden de visita de costo mínimo para un conjunto de paradas. Sin inicio ni fin el
+// recorrido es cerrado y vuelve a la primera parada; con inicio y/o fin es un camino
+// abierto con esos extremos fijos (inicio == fin da un recorrido cerrado desde inicio).
+// Los costos entre paradas salen de una búsqueda por parada en paralelo que se detiene
+// al cerrar todas las demás; su árbol de predecesores se conserva para expandir los
+// tramos sin volver a buscar. Con pocas paradas el orden es exacto (Held-Karp); con
+// más, parte del vecino más cercano y aplica la mejor mejora 2-opt u Or-opt (evaluadas
+// en paralelo) hasta un óptimo local. Los extremos libres se modelan con un nodo ficticio
+// de costo 0, así todos los casos son un recorrido cerrado asimétrico. T no se deduce
+// de inicio ni de fin, así que pueden pasarse vértices sueltos.
+template<typename T, typename Politica = PesoDistancia>
+ResultadoItinerario<T> planificarItinerario(const GrafoPesado<T> &grafo, const std::vector<T> &paradas,
+                                            const std::optional<std::type_identity_t<T> > &inicio = std::nullopt,
+                                            const std::optional<std::type_identity_t<T> > &fin = std::nullopt,
+                                            Politica peso = Politica(),
+                                            const OpcionesItinerario &opciones = OpcionesItinerario());
+
+#endif //ITINERARIO_H
+#include "Itinerario.tpp"
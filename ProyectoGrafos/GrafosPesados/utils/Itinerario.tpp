@@ -0,0 +1,109 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+template<typename T, typename Politica>
+ResultadoItinerario<T> planificarItinerario(const GrafoPesado<T> &grafo, const std::vector<T> &paradas,
+                                            const std::optional<std::type_identity_t<T> > &inicio,
+                                            const std::optional<std::type_identity_t<T> > &fin,
+                                            Politica peso, const OpcionesItinerario &opciones) {
+    ResultadoItinerario<T> resultado;
+    std::vector<int> vertices;
+    std::vector<char> esParada(grafo.cantidadVertices(), 0);
+    auto agregar = [&](const T &parada) {
+        grafo.validarVertice(parada);
+        int vertice = grafo.getNroVertice(parada);
+        if (!esParada[vertice]) {
+            esParada[vertice] = 1;
+            vertices.push_back(vertice);
+        }
+    };
+    // El inicio queda como primera parada.
+    if (inicio) agregar(*inicio);
+    for (const auto &parada: paradas)
+        agregar(parada);
+    if (fin) agregar(*fin);
+    const int k = vertices.size();
+    if (k == 0)
+        return resultado;
+
+    auto reloj = std::chrono::steady_clock::now();
+    std::vector<double> entreParadas(static_cast<size_t>(k) * k, EspacioConsulta::INFINITO);
+    // Árbol de cada parada: (vértice, predecesor) de los vértices cerrados, ordenado por
+    // vértice. Los caminos hacia las demás paradas sólo pasan por vértices cerrados.
+    std::vector<std::vector<std::pair<int, int> > > arboles(k);
+    paraCadaIndice(k, opciones.hilos, [&](size_t i, int) {
+        EspacioConsulta &espacio = EspacioConsulta::delHilo();
+        buscarCaminos(grafo, vertices[i], espacio, peso, ParadaEnDestinos{&esParada, k});
+        for (int j = 0; j < k; j++)
+            entreParadas[i * k + j] = espacio.getCosto(vertices[j]);
+        for (int vertice: espacio.getTocados())
+            if (espacio.estaCerrado(vertice))
+                arboles[i].emplace_back(vertice, espacio.getPredecesor(vertice));
+        std::sort(arboles[i].begin(), arboles[i].end());
+    }, 1);
+    resultado.segundosMatriz = std::chrono::duration<double>(std::chrono::steady_clock::now() - reloj).count();
+
+    // Con algún extremo libre se agrega el nodo ficticio 0: sólo sale sin costo hacia el
+    // inicio (o hacia cualquiera) y sólo se llega sin costo desde el fin (o desde cualquiera).
+    resultado.cerrado = (!inicio && !fin) || (inicio && fin && *inicio == *fin);
+    const int ficticio = resultado.cerrado ? 0 : 1;
+    const int n = k + ficticio;
+    int nodoFin = -1;
+    std::vector<double> costos(static_cast<size_t>(n) * n, 0);
+    for (int i = 0; i < k; i++)
+        for (int j = 0; j < k; j++)
+            costos[static_cast<size_t>(i + ficticio) * n + j + ficticio] = entreParadas[static_cast<size_t>(i) * k + j];
+    if (!resultado.cerrado) {
+        if (fin)
+            nodoFin = std::find(vertices.begin(), vertices.end(), grafo.getNroVertice(*fin)) - vertices.begin() + 1;
+        for (int j = 1; j < n; j++) {
+            costos[j] = !inicio || j == 1 ? 0 : EspacioConsulta::INFINITO;
+            costos[static_cast<size_t>(j) * n] = nodoFin < 0 || j == nodoFin ? 0 : EspacioConsulta::INFINITO;
+        }
+    }
+
+    reloj = std::chrono::steady_clock::now();
+    std::vector<int> recorrido;
+    if (k <= opciones.maximoExacto) {
+        resultado.metodo = MetodoItinerario::EXACTO;
+        recorrido = recorridoHeldKarp(costos, n, opciones.hilos);
+    } else {
+        resultado.metodo = MetodoItinerario::BUSQUEDA_LOCAL;
+        recorrido = recorridoBusquedaLocal(costos, n, recorridoVecinoMasCercano(costos, n, nodoFin),
+                                           opciones.hilos, opciones.maxSegundos, resultado.mejoras);
+    }
+    resultado.segundosOrden = std::chrono::duration<double>(std::chrono::steady_clock::now() - reloj).count();
+
+    // Los arcos del nodo ficticio valen 0 salvo que violen un extremo fijo.
+    std::vector<int> orden;
+    double costo = 0;
+    for (int p = 0; p < n; p++) {
+        int nodo = recorrido[p], siguiente = recorrido[(p + 1) % n];
+        if (nodo >= ficticio) orden.push_back(nodo - ficticio);
+        costo += costos[static_cast<size_t>(nodo) * n + siguiente];
+    }
+    int tramos = resultado.cerrado ? k : k - 1;
+    if (costo >= EspacioConsulta::INFINITO)
+        return resultado;
+
+    // Cada tramo se expande subiendo por el árbol que guardó su parada de salida.
+    resultado.costo = costo;
+    for (int parada: orden)
+        resultado.orden.push_back(grafo.getVertice(vertices[parada]));
+    resultado.camino.push_back(grafo.getVertice(vertices[orden[0]]));
+    std::vector<int> tramo;
+    for (int t = 0; t < tramos; t++) {
+        const auto &arbol = arboles[orden[t]];
+        tramo.clear();
+        for (int vertice = vertices[orden[(t + 1) % k]]; vertice != vertices[orden[t]];) {
+            tramo.push_back(vertice);
+            auto nodo = std::lower_bound(arbol.begin(), arbol.end(), std::make_pair(vertice, INT_MIN));
+            vertice = nodo->second;
+        }
+        for (auto it = tramo.rbegin(); it != tramo.rend(); ++it)
+            resultado.camino.push_back(grafo.getVertice(*it));
+    }
+    return resultado;
+}
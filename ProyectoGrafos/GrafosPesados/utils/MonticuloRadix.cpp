@@ -0,0 +1,52 @@
+#include "MonticuloRadix.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+MonticuloRadix::MonticuloRadix() : ultimo(0), tamano(0) {
+}
+
+int MonticuloRadix::cubetaDe(uint64_t clave) const {
+    return clave == ultimo ? 0 : 64 - std::countl_zero(clave ^ ultimo);
+}
+
+void MonticuloRadix::limpiar() {
+    for (auto &cubeta: cubetas)
+        cubeta.clear();
+    ultimo = 0;
+    tamano = 0;
+}
+
+void MonticuloRadix::insertar(uint64_t clave, int vertice) {
+    if (clave < ultimo)
+        throw std::invalid_argument("Clave menor que la ultima extraida");
+    cubetas[cubetaDe(clave)].emplace_back(clave, vertice);
+    tamano++;
+}
+
+MonticuloRadix::Entrada MonticuloRadix::extraerMinimo() {
+    if (tamano == 0)
+        throw std::out_of_range("El monticulo esta vacio");
+
+    if (cubetas[0].empty()) {
+        // Redistribuye la primera cubeta no vacía tomando su mínimo como nueva referencia.
+        int indice = 1;
+        while (cubetas[indice].empty())
+            indice++;
+
+        uint64_t minimo = cubetas[indice].front().first;
+        for (const auto &entrada: cubetas[indice])
+            minimo = std::min(minimo, entrada.first);
+        ultimo = minimo;
+
+        for (const auto &entrada: cubetas[indice])
+            cubetas[cubetaDe(entrada.first)].push_back(entrada);
+        cubetas[indice].clear();
+    }
+
+    Entrada minimo = cubetas[0].back();
+    cubetas[0].pop_back();
+    tamano--;
+    return minimo;
+}
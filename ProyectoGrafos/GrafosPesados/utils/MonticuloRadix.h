@@ -0,0 +1,39 @@
+#ifndef MONTICULORADIX_H
+#define MONTICULORADIX_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Cola de prioridad monótona para claves enteras: la clave extraída nunca disminuye,
+// como ocurre en Dijkstra con pesos no negativos. Cada elemento se mueve a lo sumo
+// 64 veces entre cubetas, sin comparaciones de montículo.
+class MonticuloRadix {
+public:
+    using Entrada = std::pair<uint64_t, int>;
+
+private:
+    std::array<std::vector<Entrada>, 65> cubetas;
+    uint64_t ultimo;
+    size_t tamano;
+
+    int cubetaDe(uint64_t clave) const;
+
+public:
+    MonticuloRadix();
+
+    // Vacía la cola conservando la memoria de las cubetas.
+    void limpiar();
+
+    bool estaVacio() const { return tamano == 0; }
+
+    size_t getTamano() const { return tamano; }
+
+    // La clave no puede ser menor que la última extraída.
+    void insertar(uint64_t clave, int vertice);
+
+    Entrada extraerMinimo();
+};
+
+#endif //MONTICULORADIX_H
@@ -0,0 +1,14 @@
+#ifndef ORACULODISTANCIA_H
+#define ORACULODISTANCIA_H
+
+// Fachada común de los oráculos de distancias entre pares de vértices, para que la
+// interfaz pueda usar la matriz exacta de Floyd-Warshall o un oráculo aproximado.
+class OraculoDistancia {
+public:
+    virtual ~OraculoDistancia() = default;
+
+    // Distancia entre dos números de vértice; -1 si no hay camino.
+    virtual double obtenerDistanciaCamino(int nroOrigen, int nroDestino) const = 0;
+};
+
+#endif //ORACULODISTANCIA_H
@@ -0,0 +1,81 @@
+#include "OraculoThorupZwick.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+OraculoThorupZwick::OraculoThorupZwick(int n, int k)
+    : n(n), k(k), testigos(static_cast<size_t>(k) * n, EspacioConsulta::SIN_PREDECESOR),
+      distanciasTestigo(static_cast<size_t>(k) * n, EspacioConsulta::INFINITO), verticesPorNivel(k, 0),
+      segundosConstruccion(0) {
+}
+
+void OraculoThorupZwick::resolverEmpates() {
+    for (int i = k - 2; i >= 0; i--) {
+        const size_t nivel = static_cast<size_t>(i) * n, siguiente = nivel + n;
+        for (int v = 0; v < n; v++)
+            if (distanciasTestigo[nivel + v] < EspacioConsulta::INFINITO &&
+                distanciasTestigo[nivel + v] == distanciasTestigo[siguiente + v])
+                testigos[nivel + v] = testigos[siguiente + v];
+    }
+}
+
+void OraculoThorupZwick::armarBunches(std::vector<std::vector<std::pair<int, double> > > &clusters) {
+    desplazamientosBunch.assign(n + 1, 0);
+    for (const auto &cluster: clusters)
+        for (const auto &[vertice, distancia]: cluster)
+            desplazamientosBunch[vertice + 1]++;
+    for (int v = 0; v < n; v++)
+        desplazamientosBunch[v + 1] += desplazamientosBunch[v];
+
+    // Los centros se recorren en orden creciente, así que cada bunch queda ordenado.
+    std::vector<size_t> posiciones(desplazamientosBunch.begin(), desplazamientosBunch.end() - 1);
+    bunches.resize(desplazamientosBunch.back());
+    for (int centro = 0; centro < n; centro++) {
+        for (const auto &[vertice, distancia]: clusters[centro])
+            bunches[posiciones[vertice]++] = {centro, distancia};
+        std::vector<std::pair<int, double> >().swap(clusters[centro]);
+    }
+}
+
+const OraculoThorupZwick::EntradaBunch *OraculoThorupZwick::buscarEnBunch(int vertice, int centro) const {
+    auto primero = bunches.begin() + desplazamientosBunch[vertice];
+    auto ultimo = bunches.begin() + desplazamientosBunch[vertice + 1];
+    auto it = std::lower_bound(primero, ultimo, centro,
+                               [](const EntradaBunch &entrada, int buscado) { return entrada.centro < buscado; });
+    return it != ultimo && it->centro == centro ? &*it : nullptr;
+}
+
+double OraculoThorupZwick::obtenerDistanciaCamino(int nroOrigen, int nroDestino) const {
+    if (nroOrigen < 0 || nroOrigen >= n || nroDestino < 0 || nroDestino >= n)
+        throw std::invalid_argument("Vertice invalido");
+    int u = nroOrigen, v = nroDestino;
+    int nivel = 0;
+    int testigo = testigos[u];
+    if (testigo == EspacioConsulta::SIN_PREDECESOR)
+        return -1;
+    const EntradaBunch *entrada;
+    while ((entrada = buscarEnBunch(v, testigo)) == nullptr) {
+        if (++nivel == k)
+            return -1;
+        std::swap(u, v);
+        testigo = testigos[static_cast<size_t>(nivel) * n + u];
+        // Sin testigo en este nivel: u no comparte componente con ningún vértice de A_i.
+        if (testigo == EspacioConsulta::SIN_PREDECESOR)
+            return -1;
+    }
+    return distanciasTestigo[static_cast<size_t>(nivel) * n + u] + entrada->distancia;
+}
+
+EstadisticasOraculo OraculoThorupZwick::estadisticas() const {
+    EstadisticasOraculo resultado;
+    resultado.cantidadVertices = n;
+    resultado.k = k;
+    resultado.verticesPorNivel = verticesPorNivel;
+    resultado.totalBunch = bunches.size();
+    for (int v = 0; v < n; v++)
+        resultado.maximoBunch = std::max(resultado.maximoBunch, desplazamientosBunch[v + 1] - desplazamientosBunch[v]);
+    resultado.bytes = testigos.size() * sizeof(int) + distanciasTestigo.size() * sizeof(double) +
+                      desplazamientosBunch.size() * sizeof(size_t) + bunches.size() * sizeof(EntradaBunch);
+    resultado.segundosConstruccion = segundosConstruccion;
+    return resultado;
+}
@@ -0,0 +1,80 @@
+#ifndef ORACULOTHORUPZWICK_H
+#define ORACULOTHORUPZWICK_H
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "OraculoDistancia.h"
+#include "Paralelo.h"
+#include "../BusquedaCaminos.h"
+
+struct EstadisticasOraculo {
+    int cantidadVertices = 0;
+    int k = 0;
+    // Tamaño de cada nivel A_0 ⊇ A_1 ⊇ ... ⊇ A_{k-1}.
+    std::vector<int> verticesPorNivel;
+    size_t totalBunch = 0;
+    size_t maximoBunch = 0;
+    size_t bytes = 0;
+    double segundosConstruccion = 0;
+
+    double promedioBunch() const {
+        return cantidadVertices > 0 ? static_cast<double>(totalBunch) / cantidadVertices : 0;
+    }
+};
+
+// Oráculo aproximado de Thorup y Zwick para grafos no dirigidos. Se muestrea una cadena
+// V = A_0 ⊇ A_1 ⊇ ... ⊇ A_k = ∅ en la que cada nivel toma los vértices del anterior con
+// probabilidad n^(-1/k). Cada vértice guarda su testigo p_i(v), el más cercano de A_i,
+// y su bunch: los w de A_i \ A_{i+1} que están más cerca que A_{i+1}. Los clusters
+// (vértices cuyo bunch contiene a w) salen de Dijkstras truncados e independientes, que
+// se reparten entre los hilos. La consulta sube de nivel alternando los extremos hasta
+// que el testigo cae en el bunch del otro; la distancia devuelta está entre la real y
+// (2k - 1) veces ella, con O(k·n^(1+1/k)) memoria esperada. Con k = 1 es exacto (APSP).
+class OraculoThorupZwick : public OraculoDistancia {
+    struct EntradaBunch {
+        int32_t centro;
+        double distancia;
+    };
+
+    int n;
+    int k;
+    // testigos[i * n + v] = p_i(v) y distanciasTestigo[i * n + v] = d(A_i, v).
+    std::vector<int> testigos;
+    std::vector<double> distanciasTestigo;
+    // Bunch de cada vértice ordenado por centro.
+    std::vector<size_t> desplazamientosBunch;
+    std::vector<EntradaBunch> bunches;
+    std::vector<int> verticesPorNivel;
+    double segundosConstruccion;
+
+    OraculoThorupZwick(int n, int k);
+
+    // Los testigos de un nivel empatados con el siguiente pasan a ser los de ese nivel,
+    // así p_i(v) siempre está en el bunch de v o es un testigo de más arriba.
+    void resolverEmpates();
+
+    // clusters[w] = (v, d(w, v)) para cada v del cluster de w; se consume al armar.
+    void armarBunches(std::vector<std::vector<std::pair<int, double> > > &clusters);
+
+    const EntradaBunch *buscarEnBunch(int vertice, int centro) const;
+
+public:
+    template<typename Grafo, typename Politica = PesoDistancia>
+    static OraculoThorupZwick construir(const Grafo &grafo, int k, int hilos = cantidadHilos(),
+                                        uint64_t semilla = 1, Politica peso = Politica());
+
+    double obtenerDistanciaCamino(int nroOrigen, int nroDestino) const override;
+
+    int cantidadVertices() const { return n; }
+
+    int getK() const { return k; }
+
+    int estiramientoMaximo() const { return 2 * k - 1; }
+
+    EstadisticasOraculo estadisticas() const;
+};
+
+#endif //ORACULOTHORUPZWICK_H
+#include "OraculoThorupZwick.tpp"
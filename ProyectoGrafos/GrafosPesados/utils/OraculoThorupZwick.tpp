@@ -0,0 +1,105 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "Componentes.h"
+#include "../EspacioConsulta.h"
+
+template<typename Grafo, typename Politica>
+OraculoThorupZwick OraculoThorupZwick::construir(const Grafo &grafo, int k, int hilos, uint64_t semilla,
+                                                 Politica peso) {
+    if (grafo.esDirigido())
+        throw std::invalid_argument("El oraculo de Thorup-Zwick requiere un grafo no dirigido");
+    if (k < 1)
+        throw std::invalid_argument("k debe ser al menos 1");
+    auto inicio = std::chrono::steady_clock::now();
+    const int n = grafo.cantidadVertices();
+    hilos = std::max(1, hilos);
+    OraculoThorupZwick oraculo(n, k);
+
+    // nivel[v]: el mayor i con v en A_i; -1 para las lápidas.
+    std::vector<int> nivel(n, -1);
+    std::vector<std::vector<int> > niveles(k);
+    for (int v = 0; v < n; v++) {
+        if (!esVerticeActivo(grafo, v)) continue;
+        nivel[v] = 0;
+        niveles[0].push_back(v);
+    }
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> uniforme(0, 1);
+    const double probabilidad = niveles[0].empty() ? 0 : std::pow(niveles[0].size(), -1.0 / k);
+    for (int i = 1; i < k; i++) {
+        for (int v: niveles[i - 1])
+            if (uniforme(generador) < probabilidad) niveles[i].push_back(v);
+        // Un nivel vacío no rompe la cota pero agranda los clusters del anterior.
+        if (niveles[i].empty() && !niveles[i - 1].empty())
+            niveles[i].push_back(niveles[i - 1][generador() % niveles[i - 1].size()]);
+        for (int v: niveles[i])
+            nivel[v] = i;
+    }
+    for (int i = 0; i < k; i++)
+        oraculo.verticesPorNivel[i] = niveles[i].size();
+
+    std::vector<EspacioConsulta> espacios(hilos);
+
+    // Testigos: un Dijkstra multiorigen por nivel; el testigo de v es el de su predecesor.
+    struct OrdenDeCierre {
+        std::vector<int> &orden;
+
+        void verticeCerrado(int vertice, double costo) { orden.push_back(vertice); }
+
+        void verticeMejorado(int vertice, double costoAnterior, double costoNuevo, int predecesor) {
+        }
+
+        void adyacentesProcesados(int vertice) {
+        }
+    };
+    paraCadaIndice(k, hilos, [&](size_t i, int idHilo) {
+        EspacioConsulta &espacio = espacios[idHilo];
+        std::vector<int> orden;
+        buscarCaminos(grafo, std::span<const int>(niveles[i]), espacio, peso, SinParada(), OrdenDeCierre{orden});
+        int *testigos = oraculo.testigos.data() + i * n;
+        double *distancias = oraculo.distanciasTestigo.data() + i * n;
+        for (int v: orden) {
+            int predecesor = espacio.getPredecesor(v);
+            testigos[v] = predecesor == EspacioConsulta::SIN_PREDECESOR ? v : testigos[predecesor];
+            distancias[v] = espacio.getCosto(v);
+        }
+    }, 1);
+    oraculo.resolverEmpates();
+
+    // Cluster de w en A_i \ A_{i+1}: los v con d(w, v) < d(A_{i+1}, v). Es cerrado por
+    // caminos mínimos, así que basta un Dijkstra que no relaja más allá de ese límite.
+    std::vector<std::vector<std::pair<int, double> > > clusters(n);
+    paraCadaIndice(n, hilos, [&](size_t w, int idHilo) {
+        if (nivel[w] < 0) return;
+        const double *limite = nivel[w] + 1 < k ? oraculo.distanciasTestigo.data() + (nivel[w] + 1) * n : nullptr;
+        EspacioConsulta &espacio = espacios[idHilo];
+        espacio.preparar(n);
+        espacio.relajar(w, 0, EspacioConsulta::SIN_PREDECESOR);
+        espacio.insertarEnMonticulo(0, w);
+        auto &cluster = clusters[w];
+        while (!espacio.monticuloVacio()) {
+            auto [costo, vertice] = espacio.extraerMinimo();
+            if (espacio.estaCerrado(vertice)) continue;
+            espacio.cerrar(vertice);
+            cluster.emplace_back(vertice, costo);
+            for (const auto &adyacente: grafo.adyacentesDe(vertice)) {
+                int vecino = adyacente.indiceVertice;
+                if (espacio.estaCerrado(vecino)) continue;
+                double nuevoCosto = costo + peso(adyacente);
+                if (limite && nuevoCosto >= limite[vecino]) continue;
+                if (espacio.relajar(vecino, nuevoCosto, vertice))
+                    espacio.insertarEnMonticulo(nuevoCosto, vecino);
+            }
+        }
+    }, 16);
+    oraculo.armarBunches(clusters);
+
+    oraculo.segundosConstruccion =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return oraculo;
+}
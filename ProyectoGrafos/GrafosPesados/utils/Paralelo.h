@@ -0,0 +1,96 @@
+#ifndef PARALELO_H
+#define PARALELO_H
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Utilidades mínimas de paralelismo con std::thread compartidas por los algoritmos.
+
+inline int cantidadHilos() {
+    unsigned int hilos = std::thread::hardware_concurrency();
+    return hilos == 0 ? 1 : static_cast<int>(hilos);
+}
+
+// Ejecuta tarea(idHilo) en 'hilos' hilos y relanza la primera excepción producida.
+template<typename Tarea>
+void ejecutarEnHilos(int hilos, Tarea &&tarea) {
+    if (hilos <= 1) {
+        tarea(0);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex mutexError;
+    std::vector<std::thread> trabajadores;
+    trabajadores.reserve(hilos - 1);
+
+    auto envolver = [&](int idHilo) {
+        try {
+            tarea(idHilo);
+        } catch (...) {
+            std::lock_guard<std::mutex> candado(mutexError);
+            if (!error) error = std::current_exception();
+        }
+    };
+
+    for (int i = 1; i < hilos; i++)
+        trabajadores.emplace_back(envolver, i);
+    envolver(0);
+    for (auto &trabajador: trabajadores)
+        trabajador.join();
+
+    if (error) std::rethrow_exception(error);
+}
+
+// Reparte los índices [0, n) en bloques dinámicos; tarea(indice, idHilo).
+template<typename Tarea>
+void paraCadaIndice(size_t n, int hilos, Tarea &&tarea, size_t tamBloque = 64) {
+    hilos = std::max(1, std::min<int>(hilos, static_cast<int>((n + tamBloque - 1) / std::max<size_t>(tamBloque, 1))));
+    std::atomic<size_t> siguiente(0);
+    ejecutarEnHilos(hilos, [&](int idHilo) {
+        while (true) {
+            size_t inicio = siguiente.fetch_add(tamBloque);
+            if (inicio >= n) break;
+            size_t fin = std::min(n, inicio + tamBloque);
+            for (size_t i = inicio; i < fin; i++)
+                tarea(i, idHilo);
+        }
+    });
+}
+
+// Ordena por bloques en paralelo y luego fusiona los bloques por pares.
+template<typename Iterador, typename Comparador>
+void ordenarParalelo(Iterador inicio, Iterador fin, Comparador comparador, int hilos = cantidadHilos()) {
+    size_t n = std::distance(inicio, fin);
+    const size_t MINIMO_POR_BLOQUE = 1 << 14;
+    if (hilos <= 1 || n < 2 * MINIMO_POR_BLOQUE) {
+        std::sort(inicio, fin, comparador);
+        return;
+    }
+
+    int bloques = std::min<int>(hilos, static_cast<int>(n / MINIMO_POR_BLOQUE));
+    std::vector<size_t> limites(bloques + 1);
+    for (int i = 0; i <= bloques; i++)
+        limites[i] = n * i / bloques;
+
+    ejecutarEnHilos(bloques, [&](int idHilo) {
+        std::sort(inicio + limites[idHilo], inicio + limites[idHilo + 1], comparador);
+    });
+
+    for (int paso = 1; paso < bloques; paso *= 2) {
+        int fusiones = (bloques + 2 * paso - 1) / (2 * paso);
+        ejecutarEnHilos(fusiones, [&](int idHilo) {
+            int izquierda = idHilo * 2 * paso;
+            int medio = std::min(izquierda + paso, bloques);
+            int derecha = std::min(izquierda + 2 * paso, bloques);
+            if (medio < derecha)
+                std::inplace_merge(inicio + limites[izquierda], inicio + limites[medio],
+                                   inicio + limites[derecha], comparador);
+        });
+    }
+}
+
+#endif //PARALELO_H
@@ -0,0 +1,274 @@
+#include "Particion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+static void validarPartes(const RedAfinidad &red, int partes) {
+    if (partes < 1)
+        throw std::invalid_argument("La cantidad de partes debe ser positiva");
+    if (partes > std::max(1, red.cantidadNodos()))
+        throw std::invalid_argument("Hay mas partes que vertices");
+}
+
+static void completarEstadisticas(const RedAfinidad &red, ResultadoParticion &resultado) {
+    resultado.rutasCortadas = 0;
+    for (int v = 0; v < red.cantidadNodos(); v++)
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++)
+            if (resultado.parte[red.vecinos[a]] != resultado.parte[v]) resultado.rutasCortadas += red.pesos[a];
+    // Cada arista figura en la lista de sus dos extremos.
+    resultado.rutasCortadas /= 2;
+
+    std::vector<int> tamanos = resultado.tamanos();
+    int mayor = tamanos.empty() ? 0 : *std::max_element(tamanos.begin(), tamanos.end());
+    resultado.desbalance = red.cantidadNodos() > 0
+                               ? mayor / (static_cast<double>(red.cantidadNodos()) / resultado.partes)
+                               : 0;
+}
+
+// Empareja cada nodo con el vecino libre de arista más pesada; los nodos se recorren
+// de menor a mayor grado para que los de pocas conexiones no queden solos.
+static std::vector<int> emparejar(const RedAfinidad &red, const std::vector<double> &pesosNodo, double pesoMaximo) {
+    const int n = red.cantidadNodos();
+    std::vector<int> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    std::stable_sort(orden.begin(), orden.end(), [&](int a, int b) {
+        return red.desplazamientos[a + 1] - red.desplazamientos[a] < red.desplazamientos[b + 1] - red.desplazamientos[b];
+    });
+
+    std::vector<int> grupo(n, -1);
+    for (int v: orden) {
+        if (grupo[v] >= 0) continue;
+        grupo[v] = v;
+        int mejor = -1;
+        double mejorPeso = 0;
+        for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+            int u = red.vecinos[a];
+            if (grupo[u] >= 0 || pesosNodo[u] + pesosNodo[v] > pesoMaximo) continue;
+            if (red.pesos[a] > mejorPeso || (red.pesos[a] == mejorPeso && u < mejor)) {
+                mejorPeso = red.pesos[a];
+                mejor = u;
+            }
+        }
+        if (mejor >= 0) grupo[mejor] = v;
+    }
+    return grupo;
+}
+
+// Crece cada parte desde una semilla sumando primero los nodos más conectados a ella.
+static std::vector<int> crecerRegiones(const RedAfinidad &red, const std::vector<double> &pesosNodo, int partes) {
+    const int n = red.cantidadNodos();
+    double objetivo = std::accumulate(pesosNodo.begin(), pesosNodo.end(), 0.0) / partes;
+    std::vector<int> parte(n, -1);
+    std::vector<double> conexion(n, 0);
+    int siguienteSemilla = 0;
+    for (int p = 0; p + 1 < partes; p++) {
+        double acumulado = 0;
+        std::priority_queue<std::pair<double, int> > cola;
+        std::vector<int> tocados;
+        while (acumulado < objetivo) {
+            if (cola.empty()) {
+                while (siguienteSemilla < n && parte[siguienteSemilla] >= 0) siguienteSemilla++;
+                if (siguienteSemilla == n) break;
+                cola.push({0, siguienteSemilla});
+            }
+            auto [valor, v] = cola.top();
+            cola.pop();
+            if (parte[v] >= 0 || valor < conexion[v]) continue;
+            parte[v] = p;
+            acumulado += pesosNodo[v];
+            for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+                int u = red.vecinos[a];
+                if (parte[u] >= 0) continue;
+                if (conexion[u] == 0) tocados.push_back(u);
+                conexion[u] += red.pesos[a];
+                cola.push({conexion[u], u});
+            }
+        }
+        for (int u: tocados)
+            conexion[u] = 0;
+    }
+    for (int v = 0; v < n; v++)
+        if (parte[v] < 0) parte[v] = partes - 1;
+    return parte;
+}
+
+// Pasadas de movimientos de borde: cada nodo va a la parte vecina con la que más se
+// conecta si eso baja el corte y cabe en ella. Un nodo de una parte excedida puede
+// salir aunque el corte suba, para recuperar el balance.
+static void refinar(const RedAfinidad &red, const std::vector<double> &pesosNodo, std::vector<int> &parte,
+                    int partes, double pesoMaximoParte) {
+    const int n = red.cantidadNodos();
+    const int MAXIMO_PASADAS = 10;
+    std::vector<double> pesoParte(partes, 0);
+    for (int v = 0; v < n; v++)
+        pesoParte[parte[v]] += pesosNodo[v];
+    std::vector<double> conexion(partes, 0);
+    std::vector<int> tocadas;
+
+    for (int pasada = 0; pasada < MAXIMO_PASADAS; pasada++) {
+        int movidos = 0;
+        for (int v = 0; v < n; v++) {
+            int actual = parte[v];
+            for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+                int p = parte[red.vecinos[a]];
+                if (conexion[p] == 0) tocadas.push_back(p);
+                conexion[p] += red.pesos[a];
+            }
+            bool excedida = pesoParte[actual] > pesoMaximoParte;
+            int mejor = -1;
+            double mejorGanancia = 0;
+            for (int p: tocadas) {
+                if (p == actual || pesoParte[p] + pesosNodo[v] > pesoMaximoParte) continue;
+                double ganancia = conexion[p] - conexion[actual];
+                bool equilibra = ganancia == 0 && pesoParte[p] + pesosNodo[v] < pesoParte[actual];
+                if ((ganancia > 0 || equilibra || excedida) &&
+                    (mejor < 0 || ganancia > mejorGanancia || (ganancia == mejorGanancia && p < mejor))) {
+                    mejor = p;
+                    mejorGanancia = ganancia;
+                }
+            }
+            for (int p: tocadas)
+                conexion[p] = 0;
+            conexion[actual] = 0;
+            tocadas.clear();
+
+            if (mejor >= 0) {
+                pesoParte[actual] -= pesosNodo[v];
+                pesoParte[mejor] += pesosNodo[v];
+                parte[v] = mejor;
+                movidos++;
+            }
+        }
+        if (movidos == 0)
+            break;
+    }
+}
+
+ResultadoParticion particionMultinivel(const RedAfinidad &red, int partes, double tolerancia, int hilos) {
+    validarPartes(red, partes);
+    ResultadoParticion resultado;
+    resultado.partes = partes;
+    const int n = red.cantidadNodos();
+    const int NODOS_BASE = std::max(200, 20 * partes);
+    const double total = n;
+
+    // Cada nivel guarda su red, el peso de sus nodos y a qué nodo grueso fue cada uno.
+    std::vector<RedAfinidad> redes;
+    std::vector<std::vector<double> > pesos;
+    std::vector<std::vector<int> > proyecciones;
+    const RedAfinidad *actual = &red;
+    std::vector<double> pesosActuales(n, 1);
+    while (actual->cantidadNodos() > NODOS_BASE) {
+        std::vector<int> grupo = emparejar(*actual, pesosActuales, 1.5 * total / NODOS_BASE);
+        RedAfinidad gruesa = agregarComunidades(*actual, grupo, hilos);
+        // Sin contracción apreciable (casi sin aristas) no vale la pena seguir.
+        if (gruesa.cantidadNodos() > 0.95 * actual->cantidadNodos())
+            break;
+        std::vector<double> pesosGruesos(gruesa.cantidadNodos(), 0);
+        for (int v = 0; v < actual->cantidadNodos(); v++)
+            pesosGruesos[grupo[v]] += pesosActuales[v];
+        pesos.push_back(std::move(pesosActuales));
+        proyecciones.push_back(std::move(grupo));
+        redes.push_back(std::move(gruesa));
+        actual = &redes.back();
+        pesosActuales = std::move(pesosGruesos);
+    }
+    resultado.niveles = redes.size();
+
+    // En los niveles gruesos un solo nodo puede pesar más que la tolerancia.
+    auto pesoMaximo = [&](const std::vector<double> &pesosNivel) {
+        double mayor = pesosNivel.empty() ? 0 : *std::max_element(pesosNivel.begin(), pesosNivel.end());
+        return std::max((1 + tolerancia) * total / partes, total / partes + mayor);
+    };
+    std::vector<int> parte = crecerRegiones(*actual, pesosActuales, partes);
+    refinar(*actual, pesosActuales, parte, partes, pesoMaximo(pesosActuales));
+    for (int nivel = static_cast<int>(redes.size()) - 1; nivel >= 0; nivel--) {
+        const RedAfinidad &fina = nivel == 0 ? red : redes[nivel - 1];
+        std::vector<int> proyectada(fina.cantidadNodos());
+        for (int v = 0; v < fina.cantidadNodos(); v++)
+            proyectada[v] = parte[proyecciones[nivel][v]];
+        parte = std::move(proyectada);
+        refinar(fina, pesos[nivel], parte, partes, nivel == 0 ? (1 + tolerancia) * total / partes
+                                                              : pesoMaximo(pesos[nivel]));
+    }
+
+    resultado.parte = std::move(parte);
+    completarEstadisticas(red, resultado);
+    return resultado;
+}
+
+static void biseccionar(std::vector<int>::iterator inicio, std::vector<int>::iterator fin,
+                        const std::vector<Coordenada> &coordenadas, int primeraParte, int partes,
+                        std::vector<int> &parte) {
+    if (partes == 1) {
+        for (auto it = inicio; it != fin; ++it)
+            parte[*it] = primeraParte;
+        return;
+    }
+    double minLatitud = 90, maxLatitud = -90, minLongitud = 180, maxLongitud = -180;
+    for (auto it = inicio; it != fin; ++it) {
+        minLatitud = std::min(minLatitud, coordenadas[*it].latitud);
+        maxLatitud = std::max(maxLatitud, coordenadas[*it].latitud);
+        minLongitud = std::min(minLongitud, coordenadas[*it].longitud);
+        maxLongitud = std::max(maxLongitud, coordenadas[*it].longitud);
+    }
+    // Un grado de longitud mide cos(latitud) grados de latitud.
+    double coseno = std::cos((minLatitud + maxLatitud) / 2 * M_PI / 180);
+    bool porLatitud = maxLatitud - minLatitud >= (maxLongitud - minLongitud) * coseno;
+
+    int izquierda = partes / 2;
+    auto medio = inicio + (fin - inicio) * izquierda / partes;
+    std::nth_element(inicio, medio, fin, [&](int a, int b) {
+        return porLatitud ? coordenadas[a].latitud < coordenadas[b].latitud
+                          : coordenadas[a].longitud < coordenadas[b].longitud;
+    });
+    biseccionar(inicio, medio, coordenadas, primeraParte, izquierda, parte);
+    biseccionar(medio, fin, coordenadas, primeraParte + izquierda, partes - izquierda, parte);
+}
+
+ResultadoParticion particionCoordenadas(const RedAfinidad &red, const std::vector<Coordenada> &coordenadas,
+                                        int partes) {
+    validarPartes(red, partes);
+    ResultadoParticion resultado;
+    resultado.partes = partes;
+    const int n = red.cantidadNodos();
+    std::vector<int> conCoordenada;
+    for (int v = 0; v < n; v++)
+        if (coordenadas[v].esValida()) conCoordenada.push_back(v);
+    if (static_cast<int>(conCoordenada.size()) < partes)
+        throw std::invalid_argument("Hay menos vertices con coordenadas que partes");
+
+    resultado.parte.assign(n, -1);
+    biseccionar(conCoordenada.begin(), conCoordenada.end(), coordenadas, 0, partes, resultado.parte);
+
+    // Los nodos sin coordenada se asignan por sus vecinos ya ubicados; los aislados a la parte 0.
+    std::vector<double> conexion(partes, 0);
+    bool cambios = true;
+    while (cambios) {
+        cambios = false;
+        for (int v = 0; v < n; v++) {
+            if (resultado.parte[v] >= 0) continue;
+            int mejor = -1;
+            for (int a = red.desplazamientos[v]; a < red.desplazamientos[v + 1]; a++) {
+                int p = resultado.parte[red.vecinos[a]];
+                if (p < 0) continue;
+                conexion[p] += red.pesos[a];
+                if (mejor < 0 || conexion[p] > conexion[mejor] || (conexion[p] == conexion[mejor] && p < mejor))
+                    mejor = p;
+            }
+            std::fill(conexion.begin(), conexion.end(), 0);
+            if (mejor >= 0) {
+                resultado.parte[v] = mejor;
+                cambios = true;
+            }
+        }
+    }
+    for (int &p: resultado.parte)
+        if (p < 0) p = 0;
+
+    completarEstadisticas(red, resultado);
+    return resultado;
+}
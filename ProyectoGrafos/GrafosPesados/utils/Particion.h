@@ -0,0 +1,48 @@
+#ifndef PARTICION_H
+#define PARTICION_H
+#include <vector>
+
+#include "Comunidades.h"
+#include "../Coordenada.h"
+
+struct ResultadoParticion {
+    // Parte de cada vértice; -1 para las lápidas del modo de ids estables.
+    std::vector<int> parte;
+    int partes = 0;
+    // Rutas cuyos extremos quedaron en partes distintas (una por arco en grafos dirigidos).
+    double rutasCortadas = 0;
+    // Peso de la parte más pesada sobre el ideal n / partes.
+    double desbalance = 0;
+    int niveles = 0;
+    double segundos = 0;
+
+    std::vector<int> tamanos() const {
+        std::vector<int> resultado(partes, 0);
+        for (int p: parte)
+            if (p >= 0) resultado[p]++;
+        return resultado;
+    }
+};
+
+// Partición multinivel: contrae la red por emparejamiento de aristas pesadas hasta unos
+// pocos cientos de nodos, la divide haciendo crecer regiones y, al deshacer cada
+// contracción, mueve los vértices de borde que reducen el corte sin pasar el peso
+// máximo por parte, (1 + tolerancia) * n / partes.
+ResultadoParticion particionMultinivel(const RedAfinidad &red, int partes, double tolerancia = 0.03,
+                                       int hilos = cantidadHilos());
+
+// Bisección recursiva por coordenadas: corta por la mediana del eje de mayor extensión.
+// Los nodos sin coordenada válida van a la parte con la que más se conectan.
+ResultadoParticion particionCoordenadas(const RedAfinidad &red, const std::vector<Coordenada> &coordenadas,
+                                        int partes);
+
+template<typename Grafo>
+ResultadoParticion particionarGrafo(const Grafo &grafo, int partes, double tolerancia = 0.03,
+                                    int hilos = cantidadHilos());
+
+// 'coordenadas' está indexado por número de vértice, como en ImportadorCSV.
+template<typename Grafo>
+ResultadoParticion particionarGrafo(const Grafo &grafo, const std::vector<Coordenada> &coordenadas, int partes);
+
+#endif //PARTICION_H
+#include "Particion.tpp"
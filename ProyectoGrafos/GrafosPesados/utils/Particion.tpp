@@ -0,0 +1,38 @@
+#pragma once
+#include <chrono>
+#include <stdexcept>
+
+// Lleva una partición de los nodos de la red a los vértices del grafo.
+inline void volcarParticion(ResultadoParticion &resultado, const std::vector<int> &nodo) {
+    std::vector<int> porNodo = std::move(resultado.parte);
+    resultado.parte.assign(nodo.size(), -1);
+    for (size_t v = 0; v < nodo.size(); v++)
+        if (nodo[v] >= 0) resultado.parte[v] = porNodo[nodo[v]];
+}
+
+template<typename Grafo>
+ResultadoParticion particionarGrafo(const Grafo &grafo, int partes, double tolerancia, int hilos) {
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<int> nodo;
+    RedAfinidad red = construirRedAfinidad(grafo, AfinidadUnitaria(), nodo, hilos);
+    ResultadoParticion resultado = particionMultinivel(red, partes, tolerancia, hilos);
+    volcarParticion(resultado, nodo);
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
+
+template<typename Grafo>
+ResultadoParticion particionarGrafo(const Grafo &grafo, const std::vector<Coordenada> &coordenadas, int partes) {
+    if (coordenadas.size() != static_cast<size_t>(grafo.cantidadVertices()))
+        throw std::invalid_argument("Se necesita una coordenada por vertice");
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<int> nodo;
+    RedAfinidad red = construirRedAfinidad(grafo, AfinidadUnitaria(), nodo);
+    std::vector<Coordenada> porNodo(red.cantidadNodos());
+    for (size_t v = 0; v < nodo.size(); v++)
+        if (nodo[v] >= 0) porNodo[nodo[v]] = coordenadas[v];
+    ResultadoParticion resultado = particionCoordenadas(red, porNodo, partes);
+    volcarParticion(resultado, nodo);
+    resultado.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    return resultado;
+}
@@ -0,0 +1,124 @@
+#ifndef REGISTROMUTACIONES_H
+#define REGISTROMUTACIONES_H
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <thread>
+
+#include "InstantaneaBinaria.h"
+#include "../ObservadorGrafo.h"
+
+struct EstadisticasReproduccion {
+    size_t mutaciones = 0;
+    double segundos = 0;
+
+    double mutacionesPorSegundo() const {
+        return segundos > 0 ? mutaciones / segundos : 0;
+    }
+};
+
+// Registro de escritura anticipada (WAL) de las mutaciones de un grafo.
+// Cada mutación se agrega como un registro binario con número de secuencia y
+// suma de control, y por omisión se escribe y sincroniza (fdatasync) antes de que
+// la mutación vuelva al llamador. Con mutacionesPorLote > 1 se sincroniza por lotes:
+// lo que aún no se sincronizó se pierde ante una caída, salvo que se llame a
+// sincronizar(). Si la escritura o la sincronización fallan el registro se detiene: las
+// mutaciones se siguen aplicando al grafo pero dejan de registrarse hasta volver a
+// recuperar(). Los avisos del observador nunca lanzan, porque la mutación ya está hecha
+// y los demás observadores deben recibirla; el fallo se consulta con estaDetenido().
+// Una carga masiva o renumeración del grafo guarda una instantánea completa.
+// El arranque es instantánea + reproducción del registro. La compactación copia el
+// grafo, rota el registro a <ruta>.anterior y escribe la instantánea en un hilo
+// aparte; la secuencia guardada en la instantánea evita aplicar dos veces un registro
+// si el proceso se interrumpe a mitad de camino.
+template<typename T>
+class RegistroMutaciones : public ObservadorGrafo<T> {
+    enum TipoMutacion : uint8_t {
+        INSERTAR_VERTICE = 1,
+        ELIMINAR_VERTICE = 2,
+        INSERTAR_ARISTA = 3,
+        ELIMINAR_ARISTA = 4,
+        ACTUALIZAR_PESO = 5,
+        ACTUALIZAR_CAPACIDAD = 6
+    };
+
+    static constexpr char MAGIA[4] = {'G', 'R', 'F', 'L'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t TAMANO_CABECERA = 8;
+
+private:
+    GrafoPesado<T> &grafo;
+    std::string rutaInstantanea;
+    std::string rutaRegistro;
+    size_t mutacionesPorLote;
+
+    int descriptor;
+    std::string buffer;
+    size_t pendientes;
+    uint64_t secuencia;
+    bool detenido;
+    std::string motivoDetencion;
+    std::thread compactacion;
+    std::exception_ptr errorCompactacion;
+
+    static uint32_t sumaControl(const char *datos, size_t bytes);
+
+    void abrirRegistro(bool truncar);
+
+    void cerrarRegistro();
+
+    void escribirPendientes();
+
+    // Abandona el descriptor tras un error de E/S: el estado en disco ya no es confiable.
+    void detener(const std::string &motivo);
+
+    void agregarRegistro(TipoMutacion tipo, const std::string &origen, const std::string &destino,
+                         double distancia, double tiempo, uint32_t capacidad = 0);
+
+    size_t reproducirArchivo(const std::string &ruta, uint64_t secuenciaBase);
+
+public:
+    RegistroMutaciones(GrafoPesado<T> &grafo, std::string rutaInstantanea, std::string rutaRegistro,
+                       size_t mutacionesPorLote = 1);
+
+    ~RegistroMutaciones() override;
+
+    RegistroMutaciones(const RegistroMutaciones &) = delete;
+
+    RegistroMutaciones &operator=(const RegistroMutaciones &) = delete;
+
+    // Carga la instantánea (si existe), reproduce el registro y empieza a registrar.
+    EstadisticasReproduccion recuperar();
+
+    // Escribe los registros pendientes y fuerza su persistencia.
+    void sincronizar();
+
+    void compactarEnSegundoPlano();
+
+    void esperarCompactacion();
+
+    uint64_t getSecuencia() const { return secuencia; }
+
+    bool estaDetenido() const { return detenido; }
+
+    const std::string &getMotivoDetencion() const { return motivoDetencion; }
+
+    void verticeInsertado(const T &vertice, int nroVertice) override;
+
+    void verticeEliminado(const T &vertice, int nroVertice) override;
+
+    void aristaInsertada(int nroOrigen, int nroDestino, double distancia, double tiempo) override;
+
+    void aristaEliminada(int nroOrigen, int nroDestino) override;
+
+    void pesoActualizado(int nroOrigen, int nroDestino, double distanciaAnterior, double tiempoAnterior,
+                         double distancia, double tiempo) override;
+
+    void capacidadActualizada(int nroOrigen, int nroDestino, uint32_t capacidadAnterior,
+                              uint32_t capacidad) override;
+
+    void grafoReemplazado() override;
+};
+
+#endif
+#include "RegistroMutaciones.tpp"
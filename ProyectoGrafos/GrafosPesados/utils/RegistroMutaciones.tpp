@@ -0,0 +1,374 @@
+#pragma once
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template<typename T>
+RegistroMutaciones<T>::RegistroMutaciones(GrafoPesado<T> &grafo, std::string rutaInstantanea,
+                                          std::string rutaRegistro, size_t mutacionesPorLote)
+    : grafo(grafo), rutaInstantanea(std::move(rutaInstantanea)), rutaRegistro(std::move(rutaRegistro)),
+      mutacionesPorLote(std::max<size_t>(mutacionesPorLote, 1)), descriptor(-1), pendientes(0), secuencia(0),
+      detenido(false) {
+}
+
+template<typename T>
+RegistroMutaciones<T>::~RegistroMutaciones() {
+    grafo.quitarObservador(this);
+    if (compactacion.joinable())
+        compactacion.join();
+    try {
+        cerrarRegistro();
+    } catch (...) {
+    }
+}
+
+template<typename T>
+uint32_t RegistroMutaciones<T>::sumaControl(const char *datos, size_t bytes) {
+    // FNV-1a: suficiente para detectar un registro truncado o a medio escribir.
+    uint32_t suma = 2166136261u;
+    for (size_t i = 0; i < bytes; i++) {
+        suma ^= static_cast<unsigned char>(datos[i]);
+        suma *= 16777619u;
+    }
+    return suma;
+}
+
+template<typename T>
+void RegistroMutaciones<T>::abrirRegistro(bool truncar) {
+    descriptor = open(rutaRegistro.c_str(), O_WRONLY | O_CREAT | O_APPEND | (truncar ? O_TRUNC : 0), 0644);
+    if (descriptor < 0)
+        throw std::runtime_error("No se pudo abrir el registro: " + rutaRegistro);
+    detenido = false;
+    motivoDetencion.clear();
+
+    struct stat informacion{};
+    if (fstat(descriptor, &informacion) != 0) {
+        detener("No se pudo consultar el registro: " + rutaRegistro);
+        throw std::runtime_error(motivoDetencion);
+    }
+    if (informacion.st_size == 0) {
+        buffer.append(MAGIA, 4);
+        buffer.append(reinterpret_cast<const char *>(&VERSION), sizeof(uint32_t));
+        escribirPendientes();
+    }
+}
+
+template<typename T>
+void RegistroMutaciones<T>::cerrarRegistro() {
+    if (descriptor < 0)
+        return;
+    escribirPendientes();
+    close(descriptor);
+    descriptor = -1;
+}
+
+template<typename T>
+void RegistroMutaciones<T>::detener(const std::string &motivo) {
+    if (descriptor >= 0)
+        close(descriptor);
+    descriptor = -1;
+    buffer.clear();
+    pendientes = 0;
+    detenido = true;
+    motivoDetencion = motivo;
+}
+
+template<typename T>
+void RegistroMutaciones<T>::escribirPendientes() {
+    if (buffer.empty())
+        return;
+    size_t escrito = 0;
+    while (escrito < buffer.size()) {
+        ssize_t resultado = write(descriptor, buffer.data() + escrito, buffer.size() - escrito);
+        if (resultado < 0) {
+            detener("No se pudo escribir el registro: " + rutaRegistro);
+            throw std::runtime_error(motivoDetencion);
+        }
+        escrito += resultado;
+    }
+    // Tras un fdatasync fallido no se sabe qué llegó al disco: no se sigue registrando.
+    if (fdatasync(descriptor) != 0) {
+        detener("No se pudo sincronizar el registro: " + rutaRegistro);
+        throw std::runtime_error(motivoDetencion);
+    }
+    buffer.clear();
+    pendientes = 0;
+}
+
+template<typename T>
+void RegistroMutaciones<T>::agregarRegistro(TipoMutacion tipo, const std::string &origen,
+                                            const std::string &destino, double distancia, double tiempo,
+                                            uint32_t capacidad) {
+    // La mutación ya se aplicó: un registro detenido la deja pasar sin registrarla.
+    if (detenido)
+        return;
+
+    // Registro: longitud (u32) | suma (u32) | secuencia (u64) | tipo (u8) | campos del tipo
+    std::string carga;
+    uint64_t numero = ++secuencia;
+    carga.append(reinterpret_cast<const char *>(&numero), sizeof(numero));
+    carga.push_back(static_cast<char>(tipo));
+
+    auto agregarCadena = [&carga](const std::string &texto) {
+        uint32_t longitud = texto.size();
+        carga.append(reinterpret_cast<const char *>(&longitud), sizeof(longitud));
+        carga.append(texto);
+    };
+    agregarCadena(origen);
+    if (tipo != INSERTAR_VERTICE && tipo != ELIMINAR_VERTICE)
+        agregarCadena(destino);
+    if (tipo == INSERTAR_ARISTA || tipo == ACTUALIZAR_PESO) {
+        carga.append(reinterpret_cast<const char *>(&distancia), sizeof(distancia));
+        carga.append(reinterpret_cast<const char *>(&tiempo), sizeof(tiempo));
+    }
+    if (tipo == ACTUALIZAR_CAPACIDAD)
+        carga.append(reinterpret_cast<const char *>(&capacidad), sizeof(capacidad));
+
+    uint32_t longitud = carga.size();
+    uint32_t suma = sumaControl(carga.data(), carga.size());
+    buffer.append(reinterpret_cast<const char *>(&longitud), sizeof(longitud));
+    buffer.append(reinterpret_cast<const char *>(&suma), sizeof(suma));
+    buffer.append(carga);
+
+    // Los observadores no lanzan: cortaría la notificación a los demás por una mutación
+    // que igual quedó hecha. El error queda en estaDetenido() / getMotivoDetencion().
+    if (++pendientes >= mutacionesPorLote) {
+        try {
+            escribirPendientes();
+        } catch (const std::runtime_error &) {
+        }
+    }
+}
+
+template<typename T>
+size_t RegistroMutaciones<T>::reproducirArchivo(const std::string &ruta, uint64_t secuenciaBase) {
+    ArchivoMapeado archivo(ruta);
+    archivo.lecturaSecuencial();
+    const char *datos = archivo.getDatos();
+    const size_t tamano = archivo.getTamano();
+
+    size_t validos = 0;
+    size_t aplicadas = 0;
+    if (tamano >= TAMANO_CABECERA) {
+        if (std::memcmp(datos, MAGIA, 4) != 0)
+            throw std::invalid_argument("El archivo no es un registro de mutaciones: " + ruta);
+        uint32_t version;
+        std::memcpy(&version, datos + 4, sizeof(version));
+        if (version != VERSION)
+            throw std::invalid_argument("Version de registro no soportada: " + std::to_string(version));
+        validos = TAMANO_CABECERA;
+    }
+
+    auto leer = [datos](size_t &posicion, auto &valor) {
+        std::memcpy(&valor, datos + posicion, sizeof(valor));
+        posicion += sizeof(valor);
+    };
+
+    // Se detiene en el primer registro incompleto o con suma inválida (cola a medio escribir).
+    while (validos > 0 && validos + 8 <= tamano) {
+        size_t posicion = validos;
+        uint32_t longitud, suma;
+        leer(posicion, longitud);
+        leer(posicion, suma);
+        if (posicion + longitud > tamano || longitud < 9 || sumaControl(datos + posicion, longitud) != suma)
+            break;
+
+        const size_t fin = posicion + longitud;
+        uint64_t numero;
+        uint8_t tipo;
+        leer(posicion, numero);
+        leer(posicion, tipo);
+
+        // La suma ya validó el registro: si la carga no coincide con su tipo es corrupción.
+        auto exigir = [&](size_t bytes) {
+            if (posicion + bytes > fin) throw std::invalid_argument("Registro de mutaciones corrupto");
+        };
+        auto leerCadena = [&]() {
+            uint32_t bytes;
+            exigir(sizeof(bytes));
+            leer(posicion, bytes);
+            exigir(bytes);
+            std::string texto(datos + posicion, bytes);
+            posicion += bytes;
+            return T::fromStdString(texto);
+        };
+        T origen = leerCadena();
+        T destino = (tipo != INSERTAR_VERTICE && tipo != ELIMINAR_VERTICE) ? leerCadena() : T();
+        double distancia = 0, tiempo = 0;
+        if (tipo == INSERTAR_ARISTA || tipo == ACTUALIZAR_PESO) {
+            exigir(sizeof(distancia) + sizeof(tiempo));
+            leer(posicion, distancia);
+            leer(posicion, tiempo);
+        }
+        uint32_t capacidad = AdyacenteConPeso::SIN_CAPACIDAD;
+        if (tipo == ACTUALIZAR_CAPACIDAD) {
+            exigir(sizeof(capacidad));
+            leer(posicion, capacidad);
+        }
+        if (posicion != fin)
+            throw std::invalid_argument("Registro de mutaciones corrupto");
+
+        if (numero > secuenciaBase) {
+            switch (tipo) {
+                case INSERTAR_VERTICE: grafo.insertarVertice(origen); break;
+                case ELIMINAR_VERTICE: grafo.eliminarVertice(origen); break;
+                case INSERTAR_ARISTA: grafo.insertarArista(origen, destino, distancia, tiempo); break;
+                case ELIMINAR_ARISTA: grafo.eliminarArista(origen, destino); break;
+                case ACTUALIZAR_PESO: grafo.actualizarPesoArista(origen, destino, distancia, tiempo); break;
+                case ACTUALIZAR_CAPACIDAD: grafo.setCapacidadArista(origen, destino, capacidad); break;
+                default: throw std::invalid_argument("Tipo de mutacion desconocido");
+            }
+            aplicadas++;
+        }
+        secuencia = std::max(secuencia, numero);
+        validos = fin;
+    }
+
+    if (validos < tamano && truncate(ruta.c_str(), validos) != 0)
+        throw std::runtime_error("No se pudo recortar el registro: " + ruta);
+    return aplicadas;
+}
+
+template<typename T>
+EstadisticasReproduccion RegistroMutaciones<T>::recuperar() {
+    esperarCompactacion();
+    grafo.quitarObservador(this);
+    cerrarRegistro();
+
+    uint64_t secuenciaInstantanea = 0;
+    if (std::filesystem::exists(rutaInstantanea))
+        InstantaneaBinaria<T>::cargar(rutaInstantanea, &secuenciaInstantanea).volcarEn(grafo);
+    else
+        grafo.cargarMasivo({}, {});
+    secuencia = secuenciaInstantanea;
+
+    EstadisticasReproduccion estadisticas;
+    auto inicio = std::chrono::steady_clock::now();
+
+    const std::string rutaAnterior = rutaRegistro + ".anterior";
+    bool habiaAnterior = std::filesystem::exists(rutaAnterior);
+    if (habiaAnterior)
+        estadisticas.mutaciones += reproducirArchivo(rutaAnterior, secuenciaInstantanea);
+    if (std::filesystem::exists(rutaRegistro))
+        estadisticas.mutaciones += reproducirArchivo(rutaRegistro, secuenciaInstantanea);
+
+    estadisticas.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    // Una compactación interrumpida se termina aquí mismo antes de seguir registrando.
+    if (habiaAnterior) {
+        InstantaneaBinaria<T>::guardar(GrafoCompacto<T>::desdeGrafo(grafo), rutaInstantanea, secuencia);
+        std::filesystem::remove(rutaAnterior);
+        sincronizarDirectorioDe(rutaAnterior);
+    }
+    abrirRegistro(habiaAnterior);
+    grafo.agregarObservador(this);
+    return estadisticas;
+}
+
+template<typename T>
+void RegistroMutaciones<T>::sincronizar() {
+    if (descriptor >= 0)
+        escribirPendientes();
+}
+
+template<typename T>
+void RegistroMutaciones<T>::compactarEnSegundoPlano() {
+    esperarCompactacion();
+    if (descriptor < 0)
+        throw std::logic_error("El registro no esta abierto; llame a recuperar() primero");
+
+    const std::string rutaAnterior = rutaRegistro + ".anterior";
+    if (std::filesystem::exists(rutaAnterior))
+        throw std::runtime_error("Hay una compactacion incompleta; llame a recuperar()");
+
+    // La copia se toma en este hilo; el hilo de fondo sólo escribe el archivo.
+    GrafoCompacto<T> copia = GrafoCompacto<T>::desdeGrafo(grafo);
+    uint64_t secuenciaCopia = secuencia;
+    cerrarRegistro();
+    std::filesystem::rename(rutaRegistro, rutaAnterior);
+    abrirRegistro(true);
+    // El renombre y el registro nuevo deben ser persistentes antes de aceptar mutaciones.
+    sincronizarDirectorioDe(rutaRegistro);
+
+    compactacion = std::thread([this, copia = std::move(copia), secuenciaCopia, rutaAnterior]() {
+        try {
+            InstantaneaBinaria<T>::guardar(copia, rutaInstantanea, secuenciaCopia);
+            std::filesystem::remove(rutaAnterior);
+            sincronizarDirectorioDe(rutaAnterior);
+        } catch (...) {
+            errorCompactacion = std::current_exception();
+        }
+    });
+}
+
+template<typename T>
+void RegistroMutaciones<T>::esperarCompactacion() {
+    if (compactacion.joinable())
+        compactacion.join();
+    if (errorCompactacion) {
+        std::exception_ptr error = errorCompactacion;
+        errorCompactacion = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+template<typename T>
+void RegistroMutaciones<T>::verticeInsertado(const T &vertice, int nroVertice) {
+    agregarRegistro(INSERTAR_VERTICE, vertice.toStdString(), std::string(), 0, 0);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::verticeEliminado(const T &vertice, int nroVertice) {
+    agregarRegistro(ELIMINAR_VERTICE, vertice.toStdString(), std::string(), 0, 0);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::aristaInsertada(int nroOrigen, int nroDestino, double distancia, double tiempo) {
+    agregarRegistro(INSERTAR_ARISTA, grafo.getVertice(nroOrigen).toStdString(),
+                    grafo.getVertice(nroDestino).toStdString(), distancia, tiempo);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::aristaEliminada(int nroOrigen, int nroDestino) {
+    agregarRegistro(ELIMINAR_ARISTA, grafo.getVertice(nroOrigen).toStdString(),
+                    grafo.getVertice(nroDestino).toStdString(), 0, 0);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::pesoActualizado(int nroOrigen, int nroDestino, double distanciaAnterior,
+                                            double tiempoAnterior, double distancia, double tiempo) {
+    agregarRegistro(ACTUALIZAR_PESO, grafo.getVertice(nroOrigen).toStdString(),
+                    grafo.getVertice(nroDestino).toStdString(), distancia, tiempo);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::capacidadActualizada(int nroOrigen, int nroDestino, uint32_t capacidadAnterior,
+                                                 uint32_t capacidad) {
+    agregarRegistro(ACTUALIZAR_CAPACIDAD, grafo.getVertice(nroOrigen).toStdString(),
+                    grafo.getVertice(nroDestino).toStdString(), 0, 0, capacidad);
+}
+
+template<typename T>
+void RegistroMutaciones<T>::grafoReemplazado() {
+    // Una carga masiva no se expresa como mutaciones sueltas: se guarda una instantánea
+    // con una secuencia nueva y el registro vuelve a empezar. Los registros anteriores
+    // quedan con secuencia menor, así que una caída a mitad de camino no los reaplica.
+    if (detenido)
+        return;
+    try {
+        esperarCompactacion();
+        escribirPendientes();
+        InstantaneaBinaria<T>::guardar(GrafoCompacto<T>::desdeGrafo(grafo), rutaInstantanea, ++secuencia);
+        close(descriptor);
+        descriptor = -1;
+        std::filesystem::remove(rutaRegistro + ".anterior");
+        abrirRegistro(true);
+        sincronizarDirectorioDe(rutaRegistro);
+    } catch (const std::exception &e) {
+        detener(e.what());
+    }
+}
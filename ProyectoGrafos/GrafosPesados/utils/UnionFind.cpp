@@ -0,0 +1,53 @@
+#include "UnionFind.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+UnionFind::UnionFind(int n) : cantidadConjuntos(0) {
+    reiniciar(n);
+}
+
+void UnionFind::reiniciar(int n) {
+    if (n < 0)
+        throw std::invalid_argument("Cantidad de elementos invalida");
+    padres.resize(n);
+    std::iota(padres.begin(), padres.end(), 0);
+    tamanos.assign(n, 1);
+    cantidadConjuntos = n;
+}
+
+int UnionFind::agregarElemento() {
+    padres.push_back(padres.size());
+    tamanos.push_back(1);
+    cantidadConjuntos++;
+    return padres.size() - 1;
+}
+
+int UnionFind::buscar(int elemento) {
+    // Compresión por división a la mitad: iterativa y de una sola pasada.
+    while (padres[elemento] != elemento) {
+        padres[elemento] = padres[padres[elemento]];
+        elemento = padres[elemento];
+    }
+    return elemento;
+}
+
+int UnionFind::representante(int elemento) const {
+    while (padres[elemento] != elemento)
+        elemento = padres[elemento];
+    return elemento;
+}
+
+bool UnionFind::unir(int a, int b) {
+    a = buscar(a);
+    b = buscar(b);
+    if (a == b)
+        return false;
+    if (tamanos[a] < tamanos[b])
+        std::swap(a, b);
+    padres[b] = a;
+    tamanos[a] += tamanos[b];
+    cantidadConjuntos--;
+    return true;
+}
@@ -0,0 +1,39 @@
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+#include <vector>
+
+// Conjuntos disjuntos con unión por tamaño y compresión de caminos.
+class UnionFind {
+private:
+    std::vector<int> padres;
+    std::vector<int> tamanos;
+    int cantidadConjuntos;
+
+public:
+    explicit UnionFind(int n = 0);
+
+    // Vuelve a n conjuntos unitarios conservando la memoria.
+    void reiniciar(int n);
+
+    // Agrega un conjunto unitario y devuelve su elemento.
+    int agregarElemento();
+
+    int buscar(int elemento);
+
+    // Sin compresión: no modifica la estructura y puede usarse desde varios lectores.
+    // La unión por tamaño acota la profundidad a log2(n).
+    int representante(int elemento) const;
+
+    // Devuelve false si ya estaban en el mismo conjunto.
+    bool unir(int a, int b);
+
+    bool mismoConjunto(int a, int b) const { return representante(a) == representante(b); }
+
+    int tamanoConjunto(int elemento) const { return tamanos[representante(elemento)]; }
+
+    int getCantidadConjuntos() const { return cantidadConjuntos; }
+
+    int getCantidadElementos() const { return padres.size(); }
+};
+
+#endif //UNIONFIND_H
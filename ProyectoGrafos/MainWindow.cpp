@@ -3,6 +3,7 @@
 #include <QMenuBar>
 #include <QToolBar>
 #include <QStatusBar>
+#include <QFile>
 #include <QFileDialog>
 #include <QColorDialog>
 #include <QInputDialog>
@@ -10,8 +11,21 @@
 #include <QLabel>
 #include <QStringList>
 #include <QScrollArea>
-
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "GrafosPesados/GrafoBuilder.h"
+#include "GrafosPesados/utils/AEstrella.h"
+#include "GrafosPesados/utils/Comunidades.h"
+#include "GrafosPesados/utils/DeltaStepping.h"
+#include "GrafosPesados/utils/DijkstraRadix.h"
 #include "GrafosPesados/utils/FloydWarshall.h"
+#include "GrafosPesados/utils/FlujoMaximo.h"
+#include "GrafosPesados/utils/ImportadorCSV.h"
+#include "GrafosPesados/utils/InstantaneaBinaria.h"
+#include "GrafosPesados/utils/Intermediacion.h"
+#include "GrafosPesados/utils/OraculoThorupZwick.h"
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -21,10 +35,15 @@ MainWindow::MainWindow(QWidget *parent)
       , controlPanel(nullptr)
       , grafoNoDirigido(nullptr)
       , grafoDirigido(nullptr)
-      , esDirigido(false) {
+      , esDirigido(false)
+      , indiceEspacial(nullptr)
+      , registroMutaciones(nullptr) {
 
     grafoNoDirigido = new GrafoPesado<QString>();
     grafoDirigido = new DiGrafoPesado<QString>();
+    // Eliminar un aeropuerto de una red importada no debe renumerar toda la red.
+    grafoNoDirigido->activarIdsEstables();
+    grafoDirigido->activarIdsEstables();
 
     setupUI();
     setupMenus();
@@ -42,6 +61,9 @@ MainWindow::MainWindow(QWidget *parent)
 }
 
 MainWindow::~MainWindow() {
+    // El índice y el registro se quitan de los observadores del grafo: deben irse antes que él.
+    detenerRegistroMutaciones();
+    delete indiceEspacial;
     delete grafoNoDirigido;
     delete grafoDirigido;
 }
@@ -197,6 +219,28 @@ void MainWindow::setupMenus() {
     // Menú Archivo
     QMenu *archivoMenu = menuBar()->addMenu("&Archivo");
 
+    QAction *importarAction = archivoMenu->addAction("&Importar red CSV...");
+    importarAction->setShortcut(QKeySequence("Ctrl+I"));
+    connect(importarAction, &QAction::triggered, this, &MainWindow::importarCSV);
+
+    QAction *abrirAction = archivoMenu->addAction("&Abrir instantánea...");
+    abrirAction->setShortcut(QKeySequence::Open);
+    connect(abrirAction, &QAction::triggered, this, &MainWindow::abrirInstantanea);
+
+    QAction *guardarAction = archivoMenu->addAction("&Guardar instantánea...");
+    guardarAction->setShortcut(QKeySequence::Save);
+    connect(guardarAction, &QAction::triggered, this, &MainWindow::guardarInstantanea);
+
+    archivoMenu->addSeparator();
+
+    QAction *registroAction = archivoMenu->addAction("&Registrar cambios en...");
+    connect(registroAction, &QAction::triggered, this, &MainWindow::activarRegistroMutaciones);
+
+    QAction *compactarAction = archivoMenu->addAction("&Compactar registro");
+    connect(compactarAction, &QAction::triggered, this, &MainWindow::compactarRegistroMutaciones);
+
+    archivoMenu->addSeparator();
+
     QAction *salirAction = archivoMenu->addAction("&Salir");
     salirAction->setShortcut(QKeySequence::Quit);
     connect(salirAction, &QAction::triggered, this, &QWidget::close);
@@ -212,6 +256,49 @@ void MainWindow::setupMenus() {
     floydAction->setShortcut(QKeySequence("Ctrl+F"));
     connect(floydAction, &QAction::triggered, this, &MainWindow::calcularFloydWarshall);
 
+    QAction *aproximadasAction = algoritmosMenu->addAction("Distancias &aproximadas (Thorup-Zwick)...");
+    connect(aproximadasAction, &QAction::triggered, this, &MainWindow::calcularDistanciasAproximadas);
+
+    QAction *rutaCoordenadasAction = algoritmosMenu->addAction("&Ruta entre coordenadas (A*)...");
+    connect(rutaCoordenadasAction, &QAction::triggered, this, &MainWindow::calcularRutaEntreCoordenadas);
+
+    QAction *cercanosAction = algoritmosMenu->addAction("Aeropuertos &cercanos...");
+    cercanosAction->setShortcut(QKeySequence("Ctrl+K"));
+    connect(cercanosAction, &QAction::triggered, this, &MainWindow::buscarAeropuertosCercanos);
+
+    algoritmosMenu->addSeparator();
+
+    QAction *intermediacionAction = algoritmosMenu->addAction("&Intermediación (mapa de calor)");
+    intermediacionAction->setShortcut(QKeySequence("Ctrl+B"));
+    connect(intermediacionAction, &QAction::triggered, this, &MainWindow::calcularIntermediacion);
+
+    QAction *exportarIntermediacionAction = algoritmosMenu->addAction("&Exportar intermediación CSV...");
+    connect(exportarIntermediacionAction, &QAction::triggered, this, &MainWindow::exportarIntermediacion);
+
+    QAction *quitarCalorAction = algoritmosMenu->addAction("&Quitar mapa de calor");
+    connect(quitarCalorAction, &QAction::triggered, grafoWidget, &GrafoWidget::limpiarMapaCalor);
+
+    algoritmosMenu->addSeparator();
+
+    QAction *comunidadesAction = algoritmosMenu->addAction("&Comunidades (Louvain)");
+    comunidadesAction->setShortcut(QKeySequence("Ctrl+L"));
+    connect(comunidadesAction, &QAction::triggered, this, &MainWindow::calcularComunidades);
+
+    QAction *quitarComunidadesAction = algoritmosMenu->addAction("Quitar c&omunidades");
+    connect(quitarComunidadesAction, &QAction::triggered, grafoWidget, &GrafoWidget::limpiarComunidades);
+
+    // Menú Rendimiento
+    QMenu *rendimientoMenu = menuBar()->addMenu("&Rendimiento");
+
+    QAction *monticulosAction = rendimientoMenu->addAction("Comparar &montículos (binario / radix)...");
+    connect(monticulosAction, &QAction::triggered, this, &MainWindow::compararMonticulosBinarioRadix);
+
+    QAction *escaladoAction = rendimientoMenu->addAction("&Escalado de delta-stepping");
+    connect(escaladoAction, &QAction::triggered, this, &MainWindow::medirEscaladoDeltaStepping);
+
+    QAction *flujoAction = rendimientoMenu->addAction("&Flujo máximo en red sintética...");
+    connect(flujoAction, &QAction::triggered, this, &MainWindow::medirFlujoMaximoSintetico);
+
     // Menú Ayuda
     QMenu *ayudaMenu = menuBar()->addMenu("&Ayuda");
 
@@ -378,8 +465,14 @@ void MainWindow::actualizarPeso() {
 }
 
 void MainWindow::limpiarGrafo() {
+    detenerRegistroMutaciones();
+    delete indiceEspacial;
+    indiceEspacial = nullptr;
+    coordenadasAeropuertos.clear();
     grafoNoDirigido = new GrafoPesado<QString>();
     grafoDirigido = new DiGrafoPesado<QString>();
+    grafoNoDirigido->activarIdsEstables();
+    grafoDirigido->activarIdsEstables();
 
     actualizarVisualizacion();
     infoTextEdit->clear();
@@ -407,12 +500,12 @@ void MainWindow::actualizarVisualizacion() const {
     destinoCombo->clear();
 
     if (esDirigido) {
-        for (const auto &vertice: grafoDirigido->getVertices()) {
+        for (const auto &vertice: grafoDirigido->getVerticesActivos()) {
             origenCombo->addItem(vertice);
             destinoCombo->addItem(vertice);
         }
     } else {
-        for (const auto &vertice: grafoNoDirigido->getVertices()) {
+        for (const auto &vertice: grafoNoDirigido->getVerticesActivos()) {
             origenCombo->addItem(vertice);
             destinoCombo->addItem(vertice);
         }
@@ -471,7 +564,283 @@ void MainWindow::onAristaSeleccionada(const QString &origen, const QString &dest
     statusBar()->showMessage("Arista seleccionada: " + origen + " → " + destino, 2000);
 }
 
+void MainWindow::importarCSV() {
+    QString rutaVertices = QFileDialog::getOpenFileName(this, "Aeropuertos: nombre, latitud, longitud (opcional)",
+                                                        QString(), "CSV/TSV (*.csv *.tsv *.txt);;Todos (*)");
+    QString rutaAristas = QFileDialog::getOpenFileName(this, "Rutas: origen, destino, distancia, tiempo",
+                                                       QString(), "CSV/TSV (*.csv *.tsv *.txt);;Todos (*)");
+    if (rutaAristas.isEmpty())
+        return;
+
+    // El progreso procesa eventos: mientras tanto no se puede tocar el grafo.
+    bloquearInterfaz(true);
+    try {
+        GrafoBuilder<QString> builder(esDirigido, PoliticaDuplicados::MANTENER_MINIMO);
+        ImportadorCSV<QString> importador(builder);
+        importador.setProgreso([this](size_t procesados, size_t total) {
+            statusBar()->showMessage(QString("Importando... %1%").arg(total > 0 ? 100 * procesados / total : 100));
+            QApplication::processEvents();
+        });
+
+        EstadisticasImportacion estadisticasVertices;
+        if (!rutaVertices.isEmpty())
+            estadisticasVertices = importador.importarVertices(rutaVertices.toStdString());
+        EstadisticasImportacion estadisticasAristas = importador.importarAristas(rutaAristas.toStdString());
+
+        GrafoPesado<QString> &grafo = esDirigido ? *grafoDirigido : *grafoNoDirigido;
+        builder.construirEn(grafo);
+
+        // Los números del builder se conservan al volcar, así que las coordenadas siguen valiendo.
+        const std::vector<Coordenada> &coordenadas = importador.getCoordenadas();
+        coordenadasAeropuertos.clear();
+        for (size_t v = 0; v < coordenadas.size(); v++)
+            if (coordenadas[v].esValida()) coordenadasAeropuertos[grafo.getVertice(v)] = coordenadas[v];
+        delete indiceEspacial;
+        indiceEspacial = nullptr;
+        indiceEspacial = new IndiceEspacial<QString>(grafo, coordenadas, [this](const QString &vertice) {
+            return coordenadasAeropuertos.value(vertice, Coordenada());
+        });
+        actualizarVisualizacion();
+
+        QString info = "=== IMPORTACIÓN CSV ===\n\n";
+        info += QString("Aeropuertos leídos: %1 (%2 MB/s)\n")
+                .arg(estadisticasVertices.registros)
+                .arg(estadisticasVertices.mbPorSegundo(), 0, 'f', 1);
+        info += QString("Rutas leídas: %1 (%2 MB/s)\n")
+                .arg(estadisticasAristas.registros)
+                .arg(estadisticasAristas.mbPorSegundo(), 0, 'f', 1);
+        info += QString("Aeropuertos con coordenadas: %1\n").arg(indiceEspacial->cantidadUbicados());
+        infoTextEdit->setText(info);
+        bloquearInterfaz(false);
+        mostrarMensaje("Red importada correctamente.");
+    } catch (const std::exception &e) {
+        bloquearInterfaz(false);
+        mostrarMensaje("Error al importar: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::bloquearInterfaz(bool bloqueada) {
+    centralWidget->setEnabled(!bloqueada);
+    for (QAction *accion: findChildren<QAction *>())
+        accion->setEnabled(!bloqueada);
+}
+
+void MainWindow::abrirInstantanea() {
+    QString ruta = QFileDialog::getOpenFileName(this, "Abrir instantánea", QString(),
+                                                "Instantánea de grafo (*.grafo);;Todos (*)");
+    if (ruta.isEmpty())
+        return;
+
+    try {
+        GrafoCompacto<QString> compacto = InstantaneaBinaria<QString>::cargar(ruta.toStdString());
+        if (compacto.esDirigido())
+            compacto.volcarEn(*grafoDirigido);
+        else
+            compacto.volcarEn(*grafoNoDirigido);
+
+        esDirigidoCheckBox->setChecked(compacto.esDirigido());
+        cambiarTipoGrafo();
+        mostrarMensaje("Instantánea cargada: " + ruta);
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al abrir la instantánea: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::guardarInstantanea() {
+    QString ruta = QFileDialog::getSaveFileName(this, "Guardar instantánea", QString(),
+                                                "Instantánea de grafo (*.grafo)");
+    if (ruta.isEmpty())
+        return;
+    if (!ruta.endsWith(".grafo"))
+        ruta += ".grafo";
+
+    try {
+        if (esDirigido)
+            InstantaneaBinaria<QString>::guardar(GrafoCompacto<QString>::desdeGrafo(*grafoDirigido), ruta.toStdString());
+        else
+            InstantaneaBinaria<QString>::guardar(GrafoCompacto<QString>::desdeGrafo(*grafoNoDirigido), ruta.toStdString());
+        mostrarMensaje("Instantánea guardada: " + ruta);
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al guardar la instantánea: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::activarRegistroMutaciones() {
+    QString ruta = QFileDialog::getSaveFileName(this, "Registrar cambios en", QString(),
+                                                "Instantánea de grafo (*.grafo)",
+                                                nullptr, QFileDialog::DontConfirmOverwrite);
+    if (ruta.isEmpty())
+        return;
+    if (!ruta.endsWith(".grafo"))
+        ruta += ".grafo";
+
+    detenerRegistroMutaciones();
+    GrafoPesado<QString> &grafo = esDirigido ? *grafoDirigido : *grafoNoDirigido;
+    const std::string rutaInstantanea = ruta.toStdString();
+    const std::string rutaRegistro = rutaInstantanea + ".wal";
+    try {
+        // Sin archivos previos se parte del grafo actual; si existen, se recupera su estado.
+        if (!QFile::exists(ruta) && !QFile::exists(QString::fromStdString(rutaRegistro)))
+            InstantaneaBinaria<QString>::guardar(GrafoCompacto<QString>::desdeGrafo(grafo), rutaInstantanea);
+
+        registroMutaciones = new RegistroMutaciones<QString>(grafo, rutaInstantanea, rutaRegistro);
+        EstadisticasReproduccion estadisticas = registroMutaciones->recuperar();
+        actualizarVisualizacion();
+        mostrarMensaje(QString("Registrando cambios en %1 (%2 mutaciones reproducidas, %3 mutaciones/s).")
+            .arg(ruta).arg(estadisticas.mutaciones).arg(estadisticas.mutacionesPorSegundo(), 0, 'f', 0));
+    } catch (const std::exception &e) {
+        detenerRegistroMutaciones();
+        mostrarMensaje("Error al activar el registro: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::compactarRegistroMutaciones() {
+    if (!registroMutaciones) {
+        mostrarMensaje("No hay un registro de cambios activo.", true);
+        return;
+    }
+    try {
+        registroMutaciones->compactarEnSegundoPlano();
+        mostrarMensaje("Compactando el registro en segundo plano.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al compactar el registro: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::detenerRegistroMutaciones() {
+    if (!registroMutaciones)
+        return;
+    // Se suelta antes de avisar, porque mostrarMensaje vuelve a revisar el registro.
+    RegistroMutaciones<QString> *registro = registroMutaciones;
+    registroMutaciones = nullptr;
+    try {
+        registro->esperarCompactacion();
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error en la compactación del registro: " + QString(e.what()), true);
+    }
+    delete registro;
+}
+
+void MainWindow::revisarRegistroMutaciones() {
+    // El registro no lanza desde los avisos del grafo: el cambio ya se aplicó y sólo
+    // dejó de registrarse, así que se informa aparte y se desactiva el registro.
+    if (!registroMutaciones || !registroMutaciones->estaDetenido())
+        return;
+    QString motivo = QString::fromStdString(registroMutaciones->getMotivoDetencion());
+    detenerRegistroMutaciones();
+    mostrarMensaje("El registro de cambios se detuvo (" + motivo +
+                   "). Los cambios siguen aplicados pero ya no se registran.", true);
+}
+
+// Exacta en redes chicas; en las grandes se estima con orígenes al azar.
+template<typename Grafo>
+static ResultadoIntermediacion calcularIntermediacionDe(const Grafo &grafo) {
+    const int MAXIMO_VERTICES_EXACTO = 2000;
+    const int PIVOTES = 256;
+    return intermediacion(grafo, grafo.cantidadVerticesActivos() > MAXIMO_VERTICES_EXACTO ? PIVOTES : 0);
+}
+
+void MainWindow::calcularIntermediacion() {
+    auto mostrar = [this](const auto &grafo) {
+        ResultadoIntermediacion resultado = calcularIntermediacionDe(grafo);
+
+        QMap<QString, double> valoresVertices;
+        QMap<QPair<QString, QString>, double> valoresAristas;
+        QVector<QPair<double, QString> > ranking;
+        for (int v = 0; v < grafo.cantidadVertices(); v++) {
+            if (grafo.estaEliminado(v)) continue;
+            valoresVertices[grafo.getVertice(v)] = resultado.vertices[v];
+            ranking.append(qMakePair(resultado.vertices[v], grafo.getVertice(v)));
+            auto adyacentes = grafo.adyacentesDe(v);
+            for (int j = 0; j < adyacentes.size(); j++)
+                valoresAristas[qMakePair(grafo.getVertice(v), grafo.getVertice(adyacentes[j].indiceVertice))] =
+                        resultado.deArco(v, j);
+        }
+        grafoWidget->setMapaCalor(valoresVertices, valoresAristas);
+
+        std::sort(ranking.begin(), ranking.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+        QString info = "=== CENTRALIDAD DE INTERMEDIACIÓN ===\n\n";
+        info += resultado.pivotes < grafo.cantidadVerticesActivos()
+                    ? QString("Aproximación con %1 orígenes al azar\n").arg(resultado.pivotes)
+                    : QString("Cálculo exacto\n");
+        info += QString("Tiempo: %1 ms\n\n").arg(resultado.segundos * 1000, 0, 'f', 1);
+        info += "Aeropuertos más críticos:\n";
+        for (int i = 0; i < std::min<int>(10, ranking.size()); i++)
+            info += QString("%1. %2: %3\n").arg(i + 1).arg(ranking[i].second).arg(ranking[i].first, 0, 'f', 1);
+        infoTextEdit->setText(info);
+    };
+
+    try {
+        if (esDirigido)
+            mostrar(*grafoDirigido);
+        else
+            mostrar(*grafoNoDirigido);
+        mostrarMensaje("Mapa de calor de intermediación actualizado.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al calcular la intermediación: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::exportarIntermediacion() {
+    QString ruta = QFileDialog::getSaveFileName(this, "Exportar intermediación", QString(), "CSV (*.csv)");
+    if (ruta.isEmpty())
+        return;
+    if (!ruta.endsWith(".csv"))
+        ruta += ".csv";
+    // Las rutas van a un segundo archivo junto al de aeropuertos.
+    QString rutaAristas = ruta.left(ruta.size() - 4) + "_rutas.csv";
+
+    try {
+        if (esDirigido)
+            exportarIntermediacionCSV(*grafoDirigido, calcularIntermediacionDe(*grafoDirigido),
+                                      ruta.toStdString(), rutaAristas.toStdString());
+        else
+            exportarIntermediacionCSV(*grafoNoDirigido, calcularIntermediacionDe(*grafoNoDirigido),
+                                      ruta.toStdString(), rutaAristas.toStdString());
+        mostrarMensaje("Intermediación exportada: " + ruta + " y " + rutaAristas);
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al exportar la intermediación: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::calcularComunidades() {
+    auto mostrar = [this](const auto &grafo) {
+        ResultadoComunidades resultado = detectarComunidades(grafo);
+
+        QMap<QString, int> comunidades;
+        QVector<QStringList> miembros(resultado.cantidad);
+        for (int v = 0; v < grafo.cantidadVertices(); v++) {
+            if (resultado.comunidad[v] < 0) continue;
+            comunidades[grafo.getVertice(v)] = resultado.comunidad[v];
+            miembros[resultado.comunidad[v]].append(grafo.getVertice(v));
+        }
+        grafoWidget->setComunidades(comunidades);
+
+        std::sort(miembros.begin(), miembros.end(),
+                  [](const QStringList &a, const QStringList &b) { return a.size() > b.size(); });
+        QString info = "=== COMUNIDADES (LOUVAIN) ===\n\n";
+        info += QString("Comunidades: %1\n").arg(resultado.cantidad);
+        info += QString("Modularidad: %1\n").arg(resultado.modularidad, 0, 'f', 4);
+        info += QString("Niveles: %1\n").arg(resultado.niveles);
+        info += QString("Tiempo: %1 ms\n\n").arg(resultado.segundos * 1000, 0, 'f', 1);
+        for (int i = 0; i < std::min<int>(10, miembros.size()); i++)
+            info += QString("%1. (%2) %3\n").arg(i + 1).arg(miembros[i].size()).arg(miembros[i].join(", "));
+        infoTextEdit->setText(info);
+    };
+
+    try {
+        if (esDirigido)
+            mostrar(*grafoDirigido);
+        else
+            mostrar(*grafoNoDirigido);
+        mostrarMensaje("Comunidades calculadas.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al calcular las comunidades: " + QString(e.what()), true);
+    }
+}
+
 void MainWindow::mostrarMensaje(const QString &mensaje, bool esError) {
+    revisarRegistroMutaciones();
     if (esError) {
         QMessageBox::warning(this, "Error", mensaje);
         statusBar()->showMessage("Error: " + mensaje, 5000);
@@ -488,33 +857,37 @@ void MainWindow::configurarEjemploVuelos() {
         "Yacuiba"
     };
 
+    // Las rutas repetidas (p. ej. Santa Cruz - Sucre) se resuelven conservando la más corta
+    GrafoBuilder<QString> builder(false, PoliticaDuplicados::MANTENER_MINIMO);
     for (const auto& aeropuerto : aeropuertos) {
-        grafoNoDirigido->insertarVertice(aeropuerto);
-    }
-
-    grafoNoDirigido->insertarArista("Cochabamba", "La Paz", 240, 0.75);
-    grafoNoDirigido->insertarArista("Cochabamba", "Sucre", 228, 0.6667);
-    grafoNoDirigido->insertarArista("Cochabamba", "Oruro", 111, 0.5833);
-    grafoNoDirigido->insertarArista("La Paz", "Cochabamba", 240, 0.75);
-    grafoNoDirigido->insertarArista("La Paz", "Rurrenabaque", 243, 0.8333);
-    grafoNoDirigido->insertarArista("La Paz", "Sucre", 443, 1.0);
-    grafoNoDirigido->insertarArista("La Paz", "Cobija", 612, 1.0833);
-    grafoNoDirigido->insertarArista("La Paz", "Tarija", 669, 1.1667);
-    grafoNoDirigido->insertarArista("La Paz", "Trinidad", 401, 0.9167);
-    grafoNoDirigido->insertarArista("La Paz", "Santa Cruz", 555, 1.0833);
-    grafoNoDirigido->insertarArista("La Paz", "Uyuni", 415.211, 1);
-    grafoNoDirigido->insertarArista("La Paz", "Cuzco", 519.818, 1.15);
-    grafoNoDirigido->insertarArista("La Paz", "Iquique", 492.459, 1.20);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Cochabamba", 322, 0.75);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Sucre", 277, 0.75);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Trinidad", 365, 0.8333);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Oruro", 417, 1.0833);
-    grafoNoDirigido->insertarArista("Santa Cruz", "La Paz", 555, 1.2167);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Sucre", 463.491, 1);
-    grafoNoDirigido->insertarArista("Santa Cruz", "Iquique", 806.281, 1.50);
-    grafoNoDirigido->insertarArista("Trinidad", "Guayaramerín", 447.398, 1.15);
-    grafoNoDirigido->insertarArista("Trinidad", "Riberalta", 440.96, 0.50);
-    grafoNoDirigido->insertarArista("Cochabamba", "Yacuiba", 568.098, 1.10);
+        builder.agregarVertice(aeropuerto);
+    }
+
+    builder.agregarArista("Cochabamba", "La Paz", 240, 0.75);
+    builder.agregarArista("Cochabamba", "Sucre", 228, 0.6667);
+    builder.agregarArista("Cochabamba", "Oruro", 111, 0.5833);
+    builder.agregarArista("La Paz", "Cochabamba", 240, 0.75);
+    builder.agregarArista("La Paz", "Rurrenabaque", 243, 0.8333);
+    builder.agregarArista("La Paz", "Sucre", 443, 1.0);
+    builder.agregarArista("La Paz", "Cobija", 612, 1.0833);
+    builder.agregarArista("La Paz", "Tarija", 669, 1.1667);
+    builder.agregarArista("La Paz", "Trinidad", 401, 0.9167);
+    builder.agregarArista("La Paz", "Santa Cruz", 555, 1.0833);
+    builder.agregarArista("La Paz", "Uyuni", 415.211, 1);
+    builder.agregarArista("La Paz", "Cuzco", 519.818, 1.15);
+    builder.agregarArista("La Paz", "Iquique", 492.459, 1.20);
+    builder.agregarArista("Santa Cruz", "Cochabamba", 322, 0.75);
+    builder.agregarArista("Santa Cruz", "Sucre", 277, 0.75);
+    builder.agregarArista("Santa Cruz", "Trinidad", 365, 0.8333);
+    builder.agregarArista("Santa Cruz", "Oruro", 417, 1.0833);
+    builder.agregarArista("Santa Cruz", "La Paz", 555, 1.2167);
+    builder.agregarArista("Santa Cruz", "Sucre", 463.491, 1);
+    builder.agregarArista("Santa Cruz", "Iquique", 806.281, 1.50);
+    builder.agregarArista("Trinidad", "Guayaramerín", 447.398, 1.15);
+    builder.agregarArista("Trinidad", "Riberalta", 440.96, 0.50);
+    builder.agregarArista("Cochabamba", "Yacuiba", 568.098, 1.10);
+
+    builder.construirEn(*grafoNoDirigido);
 
     actualizarVisualizacion();
 }
@@ -530,8 +903,8 @@ void MainWindow::mostrarInformacion() const {
     }
 
     info += "Aeropuertos: " + QString::number(esDirigido ?
-            grafoDirigido->cantidadVertices() :
-            grafoNoDirigido->cantidadVertices()) + "\n";
+            grafoDirigido->cantidadVerticesActivos() :
+            grafoNoDirigido->cantidadVerticesActivos()) + "\n";
 
     info += "Rutas de vuelo: " + QString::number(esDirigido ?
             grafoDirigido->cantidadAristas() :
@@ -542,7 +915,7 @@ void MainWindow::mostrarInformacion() const {
             grafoNoDirigido->pesoTotal()) + " km\n\n";
 
     info += "Lista de aeropuertos:\n";
-    auto vertices = esDirigido ? grafoDirigido->getVertices() : grafoNoDirigido->getVertices();
+    auto vertices = esDirigido ? grafoDirigido->getVerticesActivos() : grafoNoDirigido->getVerticesActivos();
     for (const auto &aeropuerto: vertices) {
         info += "- " + aeropuerto + "\n";
     }
@@ -588,6 +961,264 @@ void MainWindow::calcularFloydWarshall() {
     }
 }
 
+void MainWindow::calcularDistanciasAproximadas() {
+    if (esDirigido) {
+        mostrarMensaje("El oráculo de Thorup-Zwick requiere un grafo no dirigido", true);
+        return;
+    }
+    bool aceptado = false;
+    int k = QInputDialog::getInt(this, "Distancias aproximadas", "k (estiramiento máximo 2k - 1):", 2, 1, 8, 1,
+                                 &aceptado);
+    if (!aceptado) return;
+
+    try {
+        OraculoThorupZwick oraculo = OraculoThorupZwick::construir(*grafoNoDirigido, k);
+        EstadisticasOraculo estadisticas = oraculo.estadisticas();
+
+        QString info = "=== DISTANCIAS APROXIMADAS (THORUP-ZWICK) ===\n\n";
+        info += QString("k: %1 (cada distancia es a lo sumo %2 veces la real)\n")
+                .arg(k).arg(oraculo.estiramientoMaximo());
+        info += QString("Bunch promedio: %1 vértices (máximo %2)\n")
+                .arg(estadisticas.promedioBunch(), 0, 'f', 1).arg(estadisticas.maximoBunch);
+        info += QString("Memoria: %1 KB\n").arg(estadisticas.bytes / 1024.0, 0, 'f', 1);
+        info += QString("Tiempo: %1 ms\n\n").arg(estadisticas.segundosConstruccion * 1000, 0, 'f', 1);
+        info += describirDistancias(oraculo, grafoNoDirigido->getVertices(), false);
+        infoTextEdit->setText(info);
+        mostrarMensaje("Distancias aproximadas calculadas.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al construir el oráculo: " + QString(e.what()), true);
+    }
+}
+
+QString MainWindow::describirDistancias(const OraculoDistancia &oraculo, const std::vector<QString> &vertices,
+                                        bool dirigido,
+                                        const std::function<std::vector<QString>(int, int)> &ruta) const {
+    std::vector<std::tuple<int, int, double> > distancias;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        for (size_t j = dirigido ? 0 : i + 1; j < vertices.size(); ++j) {
+            if (i == j) continue;
+            double distancia = oraculo.obtenerDistanciaCamino(i, j);
+            if (distancia >= 0)
+                distancias.emplace_back(i, j, distancia);
+        }
+    }
+    std::sort(distancias.begin(), distancias.end(),
+              [](const auto &a, const auto &b) { return std::get<2>(a) < std::get<2>(b); });
+
+    QString info;
+    for (const auto &[origen, destino, distancia]: distancias) {
+        info += QString("%1 %2 %3: %4 km\n").arg(vertices[origen], dirigido ? "→" : "↔", vertices[destino])
+                .arg(distancia, 0, 'f', 2);
+        if (ruta) {
+            std::vector<QString> camino = ruta(origen, destino);
+            info += "   Ruta: " + QStringList(camino.begin(), camino.end()).join(" → ") + "\n";
+        }
+    }
+    info += QString("\nPares con camino: %1\n").arg(distancias.size());
+    if (!distancias.empty()) {
+        info += QString("Distancia mínima: %1 km\n").arg(std::get<2>(distancias.front()), 0, 'f', 2);
+        info += QString("Distancia máxima: %1 km\n").arg(std::get<2>(distancias.back()), 0, 'f', 2);
+    }
+    return info;
+}
+
+void MainWindow::compararMonticulosBinarioRadix() {
+    bool aceptado = false;
+    int consultas = QInputDialog::getInt(this, "Comparar montículos", "Búsquedas completas desde orígenes distintos:",
+                                         20, 1, 10000, 1, &aceptado);
+    if (!aceptado) return;
+
+    try {
+        GrafoCompacto<QString> compacto = esDirigido
+                                              ? GrafoCompacto<QString>::desdeGrafo(*grafoDirigido)
+                                              : GrafoCompacto<QString>::desdeGrafo(*grafoNoDirigido);
+        ComparacionMonticulos comparacion = compararMonticulos(compacto, consultas);
+
+        QString info = "=== MONTÍCULO BINARIO VS RADIX ===\n\n";
+        info += QString("Red: %1 vértices, %2 arcos\n")
+                .arg(compacto.cantidadVertices()).arg(compacto.cantidadArcos());
+        info += QString("Búsquedas: %1\n\n").arg(comparacion.consultas);
+        info += QString("Topología double: %1 MB\n").arg(comparacion.bytesCompacto / 1048576.0, 0, 'f', 1);
+        info += QString("Topología entera: %1 MB\n\n").arg(comparacion.bytesEntero / 1048576.0, 0, 'f', 1);
+        info += QString("Montículo binario: %1 ms\n").arg(comparacion.segundosBinario * 1000, 0, 'f', 1);
+        info += QString("Montículo radix: %1 ms\n").arg(comparacion.segundosRadix * 1000, 0, 'f', 1);
+        info += QString("Aceleración: %1x\n").arg(comparacion.aceleracion(), 0, 'f', 2);
+        infoTextEdit->setText(info);
+        mostrarMensaje("Comparación de montículos terminada.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al comparar montículos: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::medirEscaladoDeltaStepping() {
+    try {
+        GrafoCompacto<QString> compacto = esDirigido
+                                              ? GrafoCompacto<QString>::desdeGrafo(*grafoDirigido)
+                                              : GrafoCompacto<QString>::desdeGrafo(*grafoNoDirigido);
+        if (compacto.cantidadVertices() == 0) {
+            mostrarMensaje("El grafo está vacío.", true);
+            return;
+        }
+        // El compacto descarta las lápidas: el origen se busca por nombre.
+        const std::vector<QString> &vertices = compacto.getVertices();
+        int origen = std::find(vertices.begin(), vertices.end(), origenCombo->currentText()) - vertices.begin();
+        if (origen == vertices.size())
+            origen = 0;
+
+        QString info = "=== ESCALADO DE DELTA-STEPPING ===\n\n";
+        info += QString("Origen: %1\n").arg(vertices[origen]);
+        info += QString("Red: %1 vértices, %2 arcos\n\n")
+                .arg(compacto.cantidadVertices()).arg(compacto.cantidadArcos());
+        for (const MedicionEscalado &medicion: DeltaStepping<QString>::medirEscalado(compacto, origen))
+            info += QString("%1 hilos: %2 ms (aceleración %3x)\n")
+                    .arg(medicion.hilos).arg(medicion.segundos * 1000, 0, 'f', 2)
+                    .arg(medicion.aceleracion, 0, 'f', 2);
+        infoTextEdit->setText(info);
+        mostrarMensaje("Medición de escalado terminada.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al medir delta-stepping: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::medirFlujoMaximoSintetico() {
+    bool aceptado = false;
+    int vertices = QInputDialog::getInt(this, "Flujo máximo", "Vértices de la red sintética:", 1000000, 2,
+                                        50000000, 1000, &aceptado);
+    if (!aceptado) return;
+    int grado = QInputDialog::getInt(this, "Flujo máximo", "Arcos por vértice:", 4, 1, 32, 1, &aceptado);
+    if (!aceptado) return;
+    if (static_cast<long long>(vertices) * grado > std::numeric_limits<int>::max() / 2) {
+        mostrarMensaje("La red sintética excede el tamaño admitido.", true);
+        return;
+    }
+    int consultas = QInputDialog::getInt(this, "Flujo máximo", "Pares fuente/sumidero aleatorios:", 10, 1, 1000, 1,
+                                         &aceptado);
+    if (!aceptado) return;
+
+    try {
+        auto inicio = std::chrono::steady_clock::now();
+        GrafoCompacto<int> red = redFlujoSintetica(vertices, grado, 1000);
+        double segundosGeneracion = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        MedicionFlujo medicion = medirFlujoMaximo(red, consultas);
+
+        QString info = "=== FLUJO MÁXIMO (DINIC) EN RED SINTÉTICA ===\n\n";
+        info += QString("Red: %1 vértices, %2 arcos (capacidades 1-1000)\n")
+                .arg(red.cantidadVertices()).arg(red.cantidadArcos());
+        info += QString("Arcos residuales: %1\n").arg(medicion.arcosResiduales);
+        info += QString("Generación: %1 ms\n").arg(segundosGeneracion * 1000, 0, 'f', 1);
+        info += QString("Construcción de la red residual: %1 ms\n\n")
+                .arg(medicion.segundosConstruccion * 1000, 0, 'f', 1);
+        info += QString("Consultas: %1\n").arg(medicion.consultas);
+        info += QString("Tiempo promedio: %1 ms (máximo %2 ms)\n")
+                .arg(medicion.segundosPromedio * 1000, 0, 'f', 2).arg(medicion.segundosMaximo * 1000, 0, 'f', 2);
+        info += QString("Fases promedio: %1\n").arg(medicion.fasesPromedio, 0, 'f', 1);
+        infoTextEdit->setText(info);
+        mostrarMensaje("Medición de flujo máximo terminada.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al medir el flujo máximo: " + QString(e.what()), true);
+    }
+}
+
+const IndiceEspacial<QString> *MainWindow::indiceActual() const {
+    const GrafoPesado<QString> *visible = esDirigido ? grafoDirigido : grafoNoDirigido;
+    return indiceEspacial && &indiceEspacial->getGrafo() == visible ? indiceEspacial : nullptr;
+}
+
+bool MainWindow::pedirCoordenada(const QString &titulo, Coordenada &coordenada) {
+    bool aceptado = false;
+    QString texto = QInputDialog::getText(this, titulo, "Latitud, longitud (grados decimales):", QLineEdit::Normal,
+                                          "-16.50, -68.15", &aceptado);
+    if (!aceptado) return false;
+
+    QStringList partes = texto.split(',');
+    bool latitudValida = false, longitudValida = false;
+    double latitud = partes.size() == 2 ? partes[0].trimmed().toDouble(&latitudValida) : 0;
+    double longitud = partes.size() == 2 ? partes[1].trimmed().toDouble(&longitudValida) : 0;
+    if (!latitudValida || !longitudValida || std::abs(latitud) > 90 || std::abs(longitud) > 180) {
+        mostrarMensaje("Coordenada inválida: " + texto, true);
+        return false;
+    }
+    coordenada = Coordenada(latitud, longitud);
+    return true;
+}
+
+void MainWindow::buscarAeropuertosCercanos() {
+    const IndiceEspacial<QString> *indice = indiceActual();
+    if (!indice || indice->cantidadUbicados() == 0) {
+        mostrarMensaje("Importe aeropuertos con coordenadas para usar el índice espacial", true);
+        return;
+    }
+    Coordenada punto;
+    if (!pedirCoordenada("Aeropuertos cercanos", punto)) return;
+    bool aceptado = false;
+    int cantidad = QInputDialog::getInt(this, "Aeropuertos cercanos", "Cantidad de aeropuertos:", 5, 1, 100, 1,
+                                        &aceptado);
+    if (!aceptado) return;
+    double radio = QInputDialog::getDouble(this, "Aeropuertos cercanos", "Radio (km):", 100, 0, 20000, 1,
+                                           &aceptado);
+    if (!aceptado) return;
+
+    try {
+        const GrafoPesado<QString> &grafo = indice->getGrafo();
+        QString info = "=== AEROPUERTOS CERCANOS ===\n\n";
+        info += QString("Punto: %1, %2\n\n").arg(punto.latitud, 0, 'f', 4).arg(punto.longitud, 0, 'f', 4);
+        info += QString("📍 Los %1 más cercanos:\n").arg(cantidad);
+        for (const auto &vecino: indice->masCercanos(punto, cantidad))
+            info += QString("   %1: %2 km\n").arg(grafo.getVertice(vecino.vertice)).arg(vecino.kilometros, 0, 'f', 1);
+
+        std::vector<VecinoCercano> enRadio = indice->dentroDeRadio(punto, radio);
+        info += QString("\n📍 A menos de %1 km: %2\n").arg(radio, 0, 'f', 1).arg(enRadio.size());
+        for (const auto &vecino: enRadio)
+            info += QString("   %1: %2 km\n").arg(grafo.getVertice(vecino.vertice)).arg(vecino.kilometros, 0, 'f', 1);
+        infoTextEdit->setText(info);
+        mostrarMensaje("Búsqueda espacial completada.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error en la búsqueda espacial: " + QString(e.what()), true);
+    }
+}
+
+void MainWindow::calcularRutaEntreCoordenadas() {
+    const IndiceEspacial<QString> *indice = indiceActual();
+    if (!indice || indice->cantidadUbicados() == 0) {
+        mostrarMensaje("Importe aeropuertos con coordenadas para usar el índice espacial", true);
+        return;
+    }
+    Coordenada desde, hasta;
+    if (!pedirCoordenada("Ruta: punto de partida", desde) || !pedirCoordenada("Ruta: punto de llegada", hasta))
+        return;
+
+    try {
+        const GrafoPesado<QString> &grafo = indice->getGrafo();
+        // Con costoPorKilometro = 1 la cota sobrestima si alguna ruta mide menos que la
+        // geodésica (datos redondeados o inventados): el factor sale de las propias aristas.
+        const double costoPorKilometro = costoPorKilometroAdmisible(*indice);
+        ResultadoRutaPuntos resultado = rutaEntrePuntos(*indice, desde, hasta, costoPorKilometro);
+
+        QString info = "=== RUTA ENTRE COORDENADAS (A*) ===\n\n";
+        info += QString("Partida: %1 (a %2 km del punto)\n")
+                .arg(grafo.getVertice(resultado.desde.vertice)).arg(resultado.desde.kilometros, 0, 'f', 1);
+        info += QString("Llegada: %1 (a %2 km del punto)\n\n")
+                .arg(grafo.getVertice(resultado.hasta.vertice)).arg(resultado.hasta.kilometros, 0, 'f', 1);
+        if (!resultado.ruta.existeCamino()) {
+            info += "❌ No existe camino entre los aeropuertos más cercanos\n";
+        } else {
+            QStringList ruta;
+            for (int vertice: resultado.ruta.camino)
+                ruta.append(grafo.getVertice(vertice));
+            info += "✅ Ruta: " + ruta.join(" → ") + "\n";
+            info += QString("Distancia total: %1 km\n").arg(resultado.ruta.costo, 0, 'f', 2);
+        }
+        info += QString("Vértices expandidos: %1\n").arg(resultado.ruta.expandidos);
+        info += QString("Cota geodésica: %1 km de ruta por km de arco%2\n")
+                .arg(costoPorKilometro, 0, 'f', 3)
+                .arg(costoPorKilometro == 0 ? " (sin cota: búsqueda de Dijkstra)" : "");
+        infoTextEdit->setText(info);
+        mostrarMensaje("Ruta calculada.");
+    } catch (const std::exception &e) {
+        mostrarMensaje("Error al calcular la ruta: " + QString(e.what()), true);
+    }
+}
+
 void MainWindow::mostrarResultadosDijkstra(const QString &origen, const QString &destino) const {
     QString info = "=== ALGORITMO DE DIJKSTRA ===\n\n";
     info += QString("Origen: %1\nDestino: %2\n\n").arg(origen, destino);
@@ -654,110 +1285,25 @@ void MainWindow::mostrarResultadosDijkstra(const QString &origen, const QString
 }
 void MainWindow::mostrarResultadosFloydWarshall() const {
     QString info = "=== ALGORITMO DE FLOYD-WARSHALL ===\n\n";
-    info += "Calculando todas las distancias más cortas...\n\n";
 
     try {
-        if (esDirigido) {
-            FloydWarshall floyd(*grafoDirigido);
-            floyd.ejecutarFloyd();
-
-            auto vertices = grafoDirigido->getVertices();
-
-            info += "✅ MATRIZ DE DISTANCIAS CALCULADA\n\n";
-            info += "📍 CAMINOS MÁS CORTOS:\n";
-            info += "======================\n\n";
-
-            std::vector<std::tuple<QString, QString, double, std::vector<QString>>> caminos;
-
-            for (size_t i = 0; i < vertices.size(); ++i) {
-                for (size_t j = 0; j < vertices.size(); ++j) {
-                    if (i != j) {
-                        auto camino = floyd.obtenerCaminoCompleto(vertices[i], vertices[j]);
-                        if (!camino.empty()) {
-                            double distancia = floyd.obtenerDistanciaCamino(i, j);
-                            caminos.push_back({vertices[i], vertices[j], distancia, camino});
-                        }
-                    }
-                }
-            }
-
-            std::sort(caminos.begin(), caminos.end(),
-                     [](const auto &a, const auto &b) { return std::get<2>(a) < std::get<2>(b); });
-
-            for (const auto &[origen, destino, distancia, camino] : caminos) {
-                info += QString("🎯 %1 → %2: %3 km\n")
-                       .arg(origen)
-                       .arg(destino)
-                       .arg(distancia, 0, 'f', 2);
-
-                info += "   Ruta: ";
-                for (size_t k = 0; k < camino.size(); ++k) {
-                    info += camino[k];
-                    if (k < camino.size() - 1) info += " → ";
-                }
-                info += "\n\n";
-            }
-
-            info += "📊 ESTADÍSTICAS:\n";
-            info += "================\n";
-            info += QString("Total de vértices: %1\n").arg(vertices.size());
-            info += QString("Caminos encontrados: %1\n").arg(caminos.size());
-            info += QString("Caminos posibles: %1\n").arg(vertices.size() * (vertices.size() - 1));
-
-            if (!caminos.empty()) {
-                info += QString("Distancia mínima: %1 km\n").arg(std::get<2>(caminos.front()), 0, 'f', 2);
-                info += QString("Distancia máxima: %1 km\n").arg(std::get<2>(caminos.back()), 0, 'f', 2);
-            }
-
-        } else {
-            FloydWarshall floyd(*grafoNoDirigido);
-            floyd.ejecutarFloyd();
-            auto vertices = grafoNoDirigido->getVertices();
-
-            info += "✅ MATRIZ DE DISTANCIAS CALCULADA\n\n";
-            info += "📍 CAMINOS MÁS CORTOS:\n";
-            info += "======================\n\n";
-
-            std::vector<std::tuple<QString, QString, double, std::vector<QString>>> caminos;
-
-            for (size_t i = 0; i < vertices.size(); ++i) {
-                for (size_t j = i + 1; j < vertices.size(); ++j) {
-                    auto camino = floyd.obtenerCaminoCompleto(vertices[i], vertices[j]);
-                    if (!camino.empty()) {
-                        double distancia = floyd.obtenerDistanciaCamino(i, j);
-                        caminos.push_back({vertices[i], vertices[j], distancia, camino});
-                    }
-                }
-            }
-
-            std::sort(caminos.begin(), caminos.end(),
-                     [](const auto &a, const auto &b) { return std::get<2>(a) < std::get<2>(b); });
-
-            for (const auto &[origen, destino, distancia, camino] : caminos) {
-                info += QString("🎯 %1 ↔ %2: %3 km\n")
-                       .arg(origen)
-                       .arg(destino)
-                       .arg(distancia, 0, 'f', 2);
-
-                info += "   Ruta: ";
-                for (size_t k = 0; k < camino.size(); ++k) {
-                    info += camino[k];
-                    if (k < camino.size() - 1) info += " → ";
-                }
-                info += "\n\n";
-            }
-
-            info += "📊 ESTADÍSTICAS:\n";
-            info += "================\n";
-            info += QString("Total de vértices: %1\n").arg(vertices.size());
-            info += QString("Caminos encontrados: %1\n").arg(caminos.size());
-            info += QString("Caminos posibles: %1\n").arg((vertices.size() * (vertices.size() - 1)) / 2);
-
-            if (!caminos.empty()) {
-                info += QString("Distancia mínima: %1 km\n").arg(std::get<2>(caminos.front()), 0, 'f', 2);
-                info += QString("Distancia máxima: %1 km\n").arg(std::get<2>(caminos.back()), 0, 'f', 2);
-            }
-        }
+        const GrafoPesado<QString> &grafo = esDirigido ? *grafoDirigido : *grafoNoDirigido;
+        FloydWarshall floyd(grafo);
+        floyd.ejecutarFloyd();
+        const std::vector<QString> &vertices = grafo.getVertices();
+
+        info += "✅ MATRIZ DE DISTANCIAS CALCULADA\n\n";
+        info += "📍 CAMINOS MÁS CORTOS:\n";
+        info += "======================\n\n";
+        info += describirDistancias(floyd, vertices, esDirigido, [&](int origen, int destino) {
+            return floyd.obtenerCaminoCompleto(vertices[origen], vertices[destino]);
+        });
+
+        const int activos = grafo.cantidadVerticesActivos();
+        info += "\n📊 ESTADÍSTICAS:\n";
+        info += "================\n";
+        info += QString("Total de vértices: %1\n").arg(activos);
+        info += QString("Caminos posibles: %1\n").arg(esDirigido ? activos * (activos - 1) : activos * (activos - 1) / 2);
 
         info += "\n--- INFORMACIÓN DEL ALGORITMO ---\n";
         info += "Algoritmo utilizado: Floyd-Warshall\n";
@@ -822,7 +1368,8 @@ void MainWindow::mostrarTodosLosCaminosDijkstra(const QString &origen) const {
         std::vector<QString> verticesNoAlcanzables;
         for (int i = 0; i < vertices.size(); ++i) {
             const QString &vertice = vertices[i];
-            if (vertice != origen && distancias[i] >= 1e10) {
+            bool eliminado = esDirigido ? grafoDirigido->estaEliminado(i) : grafoNoDirigido->estaEliminado(i);
+            if (vertice != origen && !eliminado && distancias[i] >= 1e10) {
                 verticesNoAlcanzables.push_back(vertice);
             }
         }
@@ -838,7 +1385,8 @@ void MainWindow::mostrarTodosLosCaminosDijkstra(const QString &origen) const {
 
         info += "📊 ESTADÍSTICAS:\n";
         info += "================\n";
-        info += QString("Total de vértices: %1\n").arg(vertices.size() - 1); // -1 para excluir origen
+        info += QString("Total de vértices: %1\n").arg((esDirigido ? grafoDirigido->cantidadVerticesActivos()
+                                                            : grafoNoDirigido->cantidadVerticesActivos()) - 1); // -1 para excluir origen
         info += QString("Destinos alcanzables: %1\n").arg(verticesOrdenados.size());
         info += QString("Destinos no alcanzables: %1\n").arg(verticesNoAlcanzables.size());
 
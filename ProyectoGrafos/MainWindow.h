@@ -2,6 +2,7 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
+#include <functional>
 #include <QHBoxLayout>
 #include <QPushButton>
 #include <QLineEdit>
@@ -15,6 +16,9 @@
 #include "GrafoWidget.h"
 #include "GrafosPesados/DiGrafoPesado.h"
 #include "GrafosPesados/GrafoPesado.h"
+#include "GrafosPesados/utils/IndiceEspacial.h"
+#include "GrafosPesados/utils/OraculoDistancia.h"
+#include "GrafosPesados/utils/RegistroMutaciones.h"
 
 
 class MainWindow : public QMainWindow {
@@ -46,6 +50,34 @@ private slots:
 
     void onAristaSeleccionada(const QString &origen, const QString &destino);
 
+    void importarCSV();
+
+    void abrirInstantanea();
+
+    void guardarInstantanea();
+
+    void activarRegistroMutaciones();
+
+    void compactarRegistroMutaciones();
+
+    void calcularIntermediacion();
+
+    void exportarIntermediacion();
+
+    void calcularComunidades();
+
+    void calcularDistanciasAproximadas();
+
+    void buscarAeropuertosCercanos();
+
+    void calcularRutaEntreCoordenadas();
+
+    void compararMonticulosBinarioRadix();
+
+    void medirEscaladoDeltaStepping();
+
+    void medirFlujoMaximoSintetico();
+
 private:
     void setupUI();
 
@@ -63,6 +95,15 @@ private:
 
     void mostrarMensaje(const QString &mensaje, bool esError = false);
 
+    // Deshabilita menús y controles mientras una operación larga procesa eventos.
+    void bloquearInterfaz(bool bloqueada);
+
+    // Deja de registrar; debe llamarse antes de borrar el grafo observado.
+    void detenerRegistroMutaciones();
+
+    // Informa y desactiva el registro si una escritura falló tras la última edición.
+    void revisarRegistroMutaciones();
+
     void configurarEjemploVuelos();
 
     void calcularRutaMasCorta();
@@ -75,6 +116,18 @@ private:
 
     void calcularFloydWarshall();
 
+    // Índice del grafo visible, o nullptr si se importó sobre el otro grafo o no hay.
+    const IndiceEspacial<QString> *indiceActual() const;
+
+    bool pedirCoordenada(const QString &titulo, Coordenada &coordenada);
+
+    // Distancias entre todos los pares según el oráculo, de menor a mayor. Los vértices
+    // eliminados no tienen camino (el oráculo da -1) y no aparecen. Si se pasa 'ruta',
+    // cada par lleva debajo la ruta que devuelve para esos números de vértice.
+    QString describirDistancias(const OraculoDistancia &oraculo, const std::vector<QString> &vertices,
+                                bool dirigido,
+                                const std::function<std::vector<QString>(int, int)> &ruta = nullptr) const;
+
 
     // Widgets principales
     QWidget *centralWidget;
@@ -118,6 +171,14 @@ private:
     DiGrafoPesado<QString> *grafoDirigido;
     bool esDirigido;
 
+    // Coordenadas de los aeropuertos importados, por nombre: el índice las recupera
+    // cuando un aeropuerto se vuelve a insertar.
+    QMap<QString, Coordenada> coordenadasAeropuertos;
+    IndiceEspacial<QString> *indiceEspacial;
+
+    // Registro de escritura anticipada del grafo visible al activarlo, o nullptr.
+    RegistroMutaciones<QString> *registroMutaciones;
+
     // Selección actual
     QString verticeSeleccionado;
     QString aristaOrigenSeleccionada;
@@ -5,9 +5,13 @@
 #include <QMessageBox>
 #include "MainWindow.h"
 #include <QLoggingCategory>
+#include "GrafosPesados/utils/CoordinadorShards.h"
 
 
 int main(int argc, char *argv[]) {
+    // Los procesos shard reutilizan este ejecutable: atienden al coordinador y salen sin abrir la interfaz.
+    if (CoordinadorShards::atenderSiEsShard(argc, argv))
+        return 0;
     QLoggingCategory::setFilterRules("qt.qpa.wayland.textinput.debug=false");
     QApplication app(argc, argv);
     // Configurar información de la aplicación